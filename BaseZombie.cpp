@@ -4,6 +4,7 @@
 #include <algorithm>
 #include "ExplosionProvider.hpp"
 #include "Guts.hpp"
+#include "FlowField.h"
 
 BaseZombie::BaseZombie(float x, float y, float health, float attackDamage, float speed, float attackRange, float attackCooldown)
     : Entity(EntityType::Enemy, Vec2(x, y), Vec2(50.f, 50.f), false, 1.0f, true),
@@ -57,6 +58,11 @@ void BaseZombie::update(float deltaTime, sf::Vector2f playerPosition) {
             setState(ZombieState::WALK);
 
             if (distance > 0) direction.normalize();
+            // Follow the shared flow field around obstacles; close in directly once near
+            Vec2 fieldDir;
+            if (flowField && distance > directChaseDistance && flowField->sample(body.position, fieldDir)) {
+                direction = fieldDir;
+            }
             if (!isMovementLocked()) body.velocity = direction * speed;
         }
         else {
@@ -80,42 +86,65 @@ void BaseZombie::update(float deltaTime, sf::Vector2f playerPosition) {
     }
 }
 
-void BaseZombie::draw(sf::RenderWindow& window) const {
+void BaseZombie::updateKinematic(float deltaTime, sf::Vector2f playerPosition) {
+    prevPos = currPos;
+    if (dead) return;
+
+    Vec2 playerPos(playerPosition.x, playerPosition.y);
+    Vec2 direction = playerPos - body.position;
+    float distance = direction.length();
+    lastSeenPlayerPos = playerPos;
+    timeSinceLastAttack += deltaTime;
+
+    if (distance > 5.0f) {
+        direction = direction * (1.0f / distance);
+        Vec2 fieldDir;
+        if (flowField && distance > directChaseDistance && flowField->sample(body.position, fieldDir)) {
+            direction = fieldDir;
+        }
+        if (!isMovementLocked()) body.velocity = direction * speed;
+    }
+    currPos = sf::Vector2f(body.position.x, body.position.y);
+}
+
+void BaseZombie::syncInterpolation() {
+    prevPos = currPos;
+    currPos = sf::Vector2f(body.position.x, body.position.y);
+}
+
+void BaseZombie::draw(RenderQueue& queue) const {
     // interpolate position
     sf::Vector2f interp = prevPos + (currPos - prevPos) * renderAlpha;
-    sf::Sprite temp = sprite;
 
-    // draw shadow if available
+    // draw shadow if available (shadow layer, unsorted, so every shadow goes out in one batch)
     if (shadowTexture) {
-        sf::Sprite sh;
-        sh.setTexture(*shadowTexture);
-        sh.setOrigin(shadowTexture->getSize().x * 0.5f, shadowTexture->getSize().y * 0.5f);
-        sh.setPosition(interp.x, interp.y + 10.0f);
-        sh.setScale(1.0f, 1.0f);
-        sh.setColor(sf::Color(0,0,0,140));
-        window.draw(sh);
+        sf::Vector2u ss = shadowTexture->getSize();
+        sf::Transform sh;
+        sh.translate(interp.x - ss.x * 0.5f, interp.y + 10.0f - ss.y * 0.5f);
+        queue.submit(RenderQueue::Layer::SHADOWS, 0.f, 0, *shadowTexture, sf::IntRect(0, 0, static_cast<int>(ss.x), static_cast<int>(ss.y)), sh, sf::Color(0,0,0,140));
     }
-    temp.setPosition(interp);
-    // Draw the sprite normally
-    window.draw(temp);
+
+    const sf::Texture* tex = sprite.getTexture();
+    if (!tex) return;
+    // Sprite transform at the interpolated position (without copying the sprite)
+    sf::Transform t;
+    t.translate(interp).rotate(sprite.getRotation()).scale(sprite.getScale()).translate(-sprite.getOrigin());
+    // Draw the sprite normally, y-sorted against other zombies and the player
+    queue.submit(RenderQueue::Layer::ENTITIES, interp.y, 0, *tex, sprite.getTextureRect(), t, sprite.getColor());
 
     // Additive white overlay to simulate brightening:
     // - subtle overlay while attacking
     // - stronger overlay during active damage frames
     if (attacking) {
-        sf::Sprite overlay = temp;
-        if (isInDamageWindow) {
-            // stronger white flash when damage can be dealt
-            overlay.setColor(sf::Color(255,255,255,220));
-            window.draw(overlay, sf::RenderStates(sf::BlendAdd));
-        } else {
-            // more subtle white glow during attack wind-up
-            overlay.setColor(sf::Color(255,255,255,60));
-            window.draw(overlay, sf::RenderStates(sf::BlendAdd));
-        }
+        // stronger white flash when damage can be dealt, more subtle glow during attack wind-up
+        sf::Color overlay = isInDamageWindow ? sf::Color(255,255,255,220) : sf::Color(255,255,255,60);
+        queue.submit(RenderQueue::Layer::ENTITIES, interp.y, 1, *tex, sprite.getTextureRect(), t, overlay, sf::BlendAdd);
     }
+}
 
+void BaseZombie::drawHealthBar(WorldOverlay& overlay) const {
     if (!dead) {
+        sf::Vector2f interp = prevPos + (currPos - prevPos) * renderAlpha;
         // Narrower health bar, darker background, positioned closer to the zombie (uses interpolated position)
         float barWidth = 36.0f;
         float barHeight = 6.0f;
@@ -126,23 +155,12 @@ void BaseZombie::draw(sf::RenderWindow& window) const {
         if (healthPercent < 0.0f) healthPercent = 0.0f;
         if (healthPercent > 1.0f) healthPercent = 1.0f;
 
+        float cy = interp.y - verticalOffset - barHeight * 0.5f;
         // Background (darker)
-        sf::RectangleShape healthBarBackground;
-        healthBarBackground.setSize(sf::Vector2f(barWidth, barHeight));
-        healthBarBackground.setFillColor(sf::Color(40, 40, 40, 220));
-        healthBarBackground.setOrigin(barWidth * 0.5f, barHeight * 0.5f);
-        healthBarBackground.setPosition(interp.x, interp.y - verticalOffset);
-
+        overlay.addRect(sf::FloatRect(interp.x - barWidth * 0.5f, cy, barWidth, barHeight), sf::Color(40, 40, 40, 220));
         // Foreground bar (centered within background)
-        sf::RectangleShape healthBar;
-        healthBar.setSize(sf::Vector2f(barWidth * healthPercent, barHeight));
-        healthBar.setFillColor(sf::Color(200, 30, 30, 220));
-        // center the foreground by setting origin to half of its current width
-        healthBar.setOrigin((barWidth * healthPercent) * 0.5f, barHeight * 0.5f);
-        healthBar.setPosition(interp.x, interp.y - verticalOffset);
-
-        window.draw(healthBarBackground);
-        window.draw(healthBar);
+        float fgWidth = barWidth * healthPercent;
+        overlay.addRect(sf::FloatRect(interp.x - fgWidth * 0.5f, cy, fgWidth, barHeight), sf::Color(200, 30, 30, 220));
     }
 }
 
@@ -161,7 +179,7 @@ void BaseZombie::attack() {
 
     // switch animator to attack frames if available
     if (hasAttackSheet && !attackRects.empty()) {
-        animator.setFrames(&attackSheetTexture, attackRects, attackFrameTime, false);
+        animator.setFrames(attackSheetTexture, attackRects, attackFrameTime, false);
         animator.play(true);
     } else if (!attackTextures.empty()) {
         animator.setFrames(&attackTextures, attackFrameTime, false);
@@ -314,7 +332,7 @@ void BaseZombie::setState(ZombieState newState) {
     // Switch animator frames depending on state (prefer sheets)
     if (currentState == ZombieState::ATTACK) {
         if (hasAttackSheet && !attackRects.empty()) {
-            animator.setFrames(&attackSheetTexture, attackRects, attackFrameTime, false);
+            animator.setFrames(attackSheetTexture, attackRects, attackFrameTime, false);
             animator.play(true);
         } else if (!attackTextures.empty()) {
             animator.setFrames(&attackTextures, attackFrameTime, false);
@@ -322,7 +340,7 @@ void BaseZombie::setState(ZombieState newState) {
         }
     } else if (currentState == ZombieState::WALK) {
         if (hasWalkSheet && !walkRects.empty()) {
-            animator.setFrames(&walkSheetTexture, walkRects, walkFrameTime, true);
+            animator.setFrames(walkSheetTexture, walkRects, walkFrameTime, true);
             animator.play(true);
         } else if (!walkTextures.empty()) {
             animator.setFrames(&walkTextures, walkFrameTime, true);
@@ -407,6 +425,16 @@ void BaseZombie::resetForSpawn(float x, float y, float healthVal, float damageVa
     // Ensure animator is configured for walking and playing
     setState(ZombieState::WALK);
     prevPos = currPos = sf::Vector2f(x, y);
+    lod = ZombieLod::FULL;
+    lodPendingTime = 0.0f;
+}
+
+float BaseZombie::consumeLodTime(float deltaTime, bool runNow) {
+    lodPendingTime += deltaTime;
+    if (!runNow) return 0.0f;
+    float dt = lodPendingTime;
+    lodPendingTime = 0.0f;
+    return dt;
 }
 
 void BaseZombie::onPlayerDeath() {
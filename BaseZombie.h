@@ -6,6 +6,10 @@
 #include <vector>
 #include <string>
 #include "include/Animator.h"
+#include "RenderQueue.h"
+#include "WorldOverlay.h"
+
+class FlowField;
 
 enum class ZombieState {
     WALK,
@@ -13,6 +17,13 @@ enum class ZombieState {
     DEATH
 };
 
+// AI level of detail tier, chosen by LevelManager from distance to the camera view
+enum class ZombieLod {
+    FULL,      // full update every tick
+    REDUCED,   // full update every few ticks, motion extrapolated in between
+    KINEMATIC  // cheap point steering only (no attacks, animation or rotation)
+};
+
 enum class ZombieType {
     WALKER,
     TANK,
@@ -27,7 +38,10 @@ public:
     virtual ~BaseZombie() = default;
 
     virtual void update(float deltaTime, sf::Vector2f playerPosition);
-    virtual void draw(sf::RenderWindow& window) const;
+    // Queue shadow, body and attack overlay into the shared sprite batch
+    virtual void draw(RenderQueue& queue) const;
+    // Queue the health bar quads into the shared world overlay
+    void drawHealthBar(WorldOverlay& overlay) const;
 
     sf::FloatRect getBounds() const;
     sf::FloatRect getHitbox() const;
@@ -70,18 +84,35 @@ public:
     void setRenderAlpha(float a) { renderAlpha = a; }
     // Shadow support: set a shadow texture to render under the zombie
     void setShadowTexture(const sf::Texture& tex) { shadowTexture = &tex; }
+    // Shared navigation field owned by LevelManager (nullptr = steer straight at the player)
+    void setFlowField(const FlowField* field) { flowField = field; }
+
+    // AI LOD support. LevelManager picks the tier and calls update(), updateKinematic()
+    // or syncInterpolation() accordingly.
+    ZombieLod getLod() const { return lod; }
+    void setLod(ZombieLod l) { lod = l; }
+    int getLodPhase() const { return lodPhase; }
+    void setLodPhase(int phase) { lodPhase = phase; }
+    // Bank a tick's time skipped by the REDUCED tier. When runNow, returns everything banked
+    // (including this tick) and clears it; otherwise returns 0.
+    float consumeLodTime(float deltaTime, bool runNow);
+    // Cheap steering for far zombies: keep walking toward the player, nothing else
+    void updateKinematic(float deltaTime, sf::Vector2f playerPosition);
+    // Advance interpolation from the physics body without running AI (skipped REDUCED ticks)
+    void syncInterpolation();
 
 protected:
     sf::Sprite sprite;
     std::vector<sf::Texture> walkTextures;
     std::vector<sf::Texture> attackTextures;
     std::vector<sf::Texture> deathTextures;
-    // Optional single-sheet support for walk animation
-    sf::Texture walkSheetTexture;
+    // Optional single-sheet support for walk animation. Sheets are owned by the derived
+    // type and shared by every instance so all zombies of a type batch into one draw.
+    const sf::Texture* walkSheetTexture = nullptr;
     std::vector<sf::IntRect> walkRects;
     bool hasWalkSheet = false;
     // Optional single-sheet support for attack animation
-    sf::Texture attackSheetTexture;
+    const sf::Texture* attackSheetTexture = nullptr;
     std::vector<sf::IntRect> attackRects;
     bool hasAttackSheet = false;
 
@@ -133,6 +164,13 @@ protected:
     void loadTextureSet(std::vector<sf::Texture>& textures, const std::string& basePath,
         const std::string& prefix, int count, bool isBoss = false);
     const sf::Texture* shadowTexture = nullptr;
+    const FlowField* flowField = nullptr;
+    // Within this distance of the player zombies ignore the flow field and close in directly
+    float directChaseDistance = 96.0f;
+    ZombieLod lod = ZombieLod::FULL;
+    int lodPhase = 0;
+    // Time skipped since the last full update while in the REDUCED tier
+    float lodPendingTime = 0.0f;
 };
 
 #endif
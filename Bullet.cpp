@@ -132,6 +132,16 @@ void Bullet::update(float dt) {
 }
 
 void Bullet::render(sf::RenderWindow& window) {
+    updateSpriteTransform();
+    window.draw(sprite);
+}
+
+void Bullet::render(SpriteBatch& batch) {
+    updateSpriteTransform();
+    batch.draw(sprite);
+}
+
+void Bullet::updateSpriteTransform() {
     float alpha = renderAlpha;
     // Interpolate position between prevPos and currPos
     sf::Vector2f interp = prevPos + (currPos - prevPos) * alpha;
@@ -147,8 +157,6 @@ void Bullet::render(sf::RenderWindow& window) {
 
     sprite.setPosition(interp.x + rotatedOffset.x, interp.y + rotatedOffset.y);
     sprite.setRotation(deg + rotationOffset);
-
-    window.draw(sprite);
 }
 
 void Bullet::onCollision(Entity* other) {
@@ -3,6 +3,7 @@
 #include "Entity.h"
 #include <unordered_set>
 #include <SFML/Graphics.hpp>
+#include "SpriteBatch.h"
 
 class Bullet : public Entity {
 public:
@@ -12,6 +13,8 @@ public:
     void update(float dt) override;
     void onCollision(Entity* other) override;
     void render(sf::RenderWindow& window) override; // matches base Entity
+    // Queue into a sprite batch instead of drawing immediately
+    void render(SpriteBatch& batch);
 
     // set interpolation alpha (0..1) before rendering
     void setRenderAlpha(float a) { renderAlpha = a; }
@@ -46,6 +49,9 @@ private:
     float spriteScale = 0.01f;
     float rotationOffset = 0.0f;
 
+    // Position/rotate the sprite at the interpolated render position
+    void updateSpriteTransform();
+
     // Interpolation positions
     sf::Vector2f prevPos;
     sf::Vector2f currPos;
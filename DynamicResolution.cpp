@@ -0,0 +1,90 @@
+#include "DynamicResolution.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Average frame time this far over target counts as missing it
+    const float kMissTolerance = 1.08f;
+    // Grow only while the work fits in this fraction of the frame
+    const float kGrowHeadroom = 0.75f;
+    const float kStep = 0.05f;
+    // Scales snap to this grid so tiny oscillations don't resize the viewport every frame
+    const float kQuantum = 0.025f;
+    const int kCooldownFrames = 20;
+    // Wait before retrying a scale that missed (~3 s at 60 fps), doubled per repeated miss
+    const int kRetryBackoffFrames = 180;
+    const int kMaxRetryBackoffFrames = 1440;
+}
+
+void DynamicResolution::setEnabled(bool e) {
+    enabled = e;
+    reset();
+}
+
+void DynamicResolution::setTargetFrameMs(float ms) {
+    if (ms > 0.0f) targetMs = ms;
+}
+
+void DynamicResolution::setScaleBounds(float lo, float hi) {
+    maxScale = std::clamp(hi, 0.1f, 1.0f);
+    minScale = std::clamp(lo, 0.1f, maxScale);
+    scale = std::clamp(scale, minScale, maxScale);
+}
+
+void DynamicResolution::reset() {
+    scale = maxScale;
+    sampleCount = 0;
+    sampleIndex = 0;
+    cooldown = 0;
+    missedScale = 0.0f;
+    retryDelay = 0;
+    backoffFrames = 0;
+}
+
+float DynamicResolution::average(const std::array<float, kWindow>& samples) const {
+    float sum = 0.0f;
+    for (int i = 0; i < sampleCount; ++i) sum += samples[i];
+    return sampleCount > 0 ? sum / sampleCount : 0.0f;
+}
+
+float DynamicResolution::update(float frameMs, float workMs) {
+    if (!enabled) return scale = maxScale;
+
+    frameSamples[sampleIndex] = frameMs;
+    workSamples[sampleIndex] = workMs;
+    sampleIndex = (sampleIndex + 1) % kWindow;
+    sampleCount = std::min(sampleCount + 1, kWindow);
+    if (retryDelay > 0) --retryDelay;
+
+    if (cooldown > 0) { --cooldown; return scale; }
+    if (sampleCount < kWindow / 2) return scale;
+
+    float avgFrame = average(frameSamples);
+    float avgWork = average(workSamples);
+    float next = scale;
+    if (avgFrame > targetMs * kMissTolerance) {
+        // Fill cost follows pixel count (scale squared), so aim for the scale whose area
+        // would have fit the target, dropping at least one step
+        float wanted = scale * std::sqrt(targetMs / avgFrame);
+        next = std::min(scale - kStep, wanted);
+        // Missing again at the scale we were retrying backs off twice as long
+        bool repeated = std::abs(scale - missedScale) < kQuantum * 0.5f;
+        backoffFrames = repeated ? std::min(backoffFrames * 2, kMaxRetryBackoffFrames) : kRetryBackoffFrames;
+        missedScale = scale;
+        retryDelay = backoffFrames;
+    } else if (avgWork < targetMs * kGrowHeadroom) {
+        next = scale + kStep;
+        // Hold below the scale that last missed until its backoff has run out
+        if (retryDelay > 0 && next >= missedScale - kQuantum * 0.5f) next = scale;
+    }
+    next = std::clamp(std::round(next / kQuantum) * kQuantum, minScale, maxScale);
+
+    if (next != scale) {
+        scale = next;
+        ++changeCount;
+        cooldown = kCooldownFrames;
+        sampleCount = 0;
+        sampleIndex = 0;
+    }
+    return scale;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <array>
+
+// Picks the world render scale from recent frame times. Frames that miss the target shrink
+// the scale right away; sustained headroom grows it back one small step at a time. After each
+// change the controller waits a few frames so the averages reflect the new scale. A scale
+// that just missed is not retried until a backoff has passed, doubling each time the retry
+// misses again, so a borderline scale doesn't turn into a periodic hitch.
+class DynamicResolution {
+public:
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return enabled; }
+    void setTargetFrameMs(float ms);
+    float getTargetFrameMs() const { return targetMs; }
+    // The world is never rendered above native resolution, so maxScale is capped at 1
+    void setScaleBounds(float minScale, float maxScale);
+
+    // Feed one frame. frameMs is the full frame interval; workMs is the part spent simulating,
+    // rendering and presenting (including GPU back-pressure in display()), excluding waits for
+    // the frame limiter. Returns the scale for the next frame.
+    float update(float frameMs, float workMs);
+    float getScale() const { return scale; }
+    void reset();
+
+    int getChangeCount() const { return changeCount; }
+    void resetStats() { changeCount = 0; }
+
+private:
+    static const int kWindow = 30;
+    float average(const std::array<float, kWindow>& samples) const;
+
+    std::array<float, kWindow> frameSamples{};
+    std::array<float, kWindow> workSamples{};
+    int sampleCount = 0;
+    int sampleIndex = 0;
+    int cooldown = 0;
+
+    // Hysteresis: the last scale that missed, frames until it may be tried again, and the
+    // current backoff length
+    float missedScale = 0.0f;
+    int retryDelay = 0;
+    int backoffFrames = 0;
+
+    bool enabled = true;
+    float targetMs = 1000.0f / 60.0f;
+    float minScale = 0.6f;
+    float maxScale = 1.0f;
+    float scale = 1.0f;
+    int changeCount = 0;
+};
@@ -1,137 +1,99 @@
 #define SFML_NO_DEPRECATED_WARNINGS
 #include "Explosion.hpp"
+#include "RenderStats.h"
+#include "ParticleSystem.hpp"
 #include <algorithm>
 #include <cstdlib>
 #include <cmath>
-#include <sstream>
 #include <string>
-#include <iostream>
-
-#ifdef _WIN32
-#include <windows.h>
-#endif
+#include <memory>
+#include <unordered_map>
 
 using namespace Props;
 
-// simple debug logger that uses OutputDebugString on Windows (visible in Visual Studio Output window)
-// falls back to std::cerr when not available
-static void dbgLog(const std::string& s) {
-#ifdef _WIN32
-    OutputDebugStringA(s.c_str());
-    OutputDebugStringA("\n");
-#else
-    std::cerr << s << std::endl;
-#endif
-}
-
 size_t Explosion::_textureID;
+std::vector<Explosion> Explosion::_pool;
+std::vector<Explosion*> Explosion::_free;
 std::vector<Explosion*> Explosion::_active;
 std::vector<float> Explosion::_preCalculatedVx;
 std::vector<float> Explosion::_preCalculatedVy;
 // define static optional texture
 sf::Texture Explosion::_texture;
-
-// Persistent ground canvas for trace decals (stains). Lazily initialized in init().
-static sf::RenderTexture _groundCanvas;
-static bool _groundCanvasReady = false;
-
-// Pending quads that were stamped before the ground canvas existed. They will be flushed
-// into the render texture once it becomes available.
-static std::vector<std::pair<sf::VertexArray, const sf::Texture*>> _pendingGroundQuads;
+CullStats Explosion::_cullStats;
+float Explosion::_tickStep = 1.0f / 120.0f;
+float Explosion::_tickAccumulator = 0.0f;
+float Explosion::_renderAlpha = 1.0f;
+
+// Effect speeds and fade amounts are expressed per tick of the 120 Hz step they were tuned at
+static const float kTuningRate = 120.0f;
+// Bound the catch-up after a hitch; older backlog is dropped rather than simulated
+static const int kMaxTicksPerUpdate = 8;
+
+// Persistent ground decals (stains) live in fixed-size world tiles that are only allocated
+// where a stain lands, so memory follows decal coverage instead of the map size.
+static const int kGroundTileSize = 512;
+struct GroundTile {
+    std::unique_ptr<sf::RenderTexture> canvas;
+    // Quads overlapping this tile collected during flushGround
+    sf::VertexArray textured{ sf::Quads };
+    sf::VertexArray plain{ sf::Quads };
+};
+static std::unordered_map<long long, GroundTile> _groundTiles;
+static bool _groundHalfRes = false;
+
+// Stain quads produced since the last flushGround(). They are stamped into the tiles
+// together, one draw per texture and a single display() per touched tile, once per frame.
+static sf::VertexArray _pendingGroundTextured(sf::Quads);
+static sf::VertexArray _pendingGroundPlain(sf::Quads);
+
+// Per-frame particle batches filled by renderAll (blood sprites / untextured chips)
+static sf::VertexArray _frameTextured(sf::Quads);
+static sf::VertexArray _framePlain(sf::Quads);
 
 // Helper that calls RenderTexture::create while suppressing the deprecation warning
-static bool createGroundCanvas(unsigned int w, unsigned int h)
+static bool createGroundCanvas(sf::RenderTexture& canvas, unsigned int w, unsigned int h)
 {
 #if defined(_MSC_VER)
 #pragma warning(push)
 #pragma warning(disable:4996)
-    bool ok = _groundCanvas.create(w, h);
+    bool ok = canvas.create(w, h);
 #pragma warning(pop)
 #else
-    bool ok = _groundCanvas.create(w, h);
+    bool ok = canvas.create(w, h);
 #endif
     return ok;
 }
 
-static void flushPendingGroundQuads()
-{
-    if (!_groundCanvasReady) return;
-    if (_pendingGroundQuads.empty()) return;
-
-    // Debug: report flush
-    {
-        std::ostringstream ss;
-        ss << "[Explosion] flushPendingGroundQuads: count=" << _pendingGroundQuads.size()
-            << " canvasSize=(" << _groundCanvas.getTexture().getSize().x << "," << _groundCanvas.getTexture().getSize().y << ")";
-        dbgLog(ss.str());
-    }
-
-    _groundCanvas.setView(_groundCanvas.getDefaultView());
-    for (auto& p : _pendingGroundQuads) {
-        const sf::VertexArray& quad = p.first;
-        const sf::Texture* tex = p.second;
-        // debug: log first vertex pos for tracing
-        if (quad.getVertexCount() > 0) {
-            const sf::Vertex& v = quad[0];
-            std::ostringstream ss;
-            ss << "[Explosion] flushing quad first-vertex=(" << v.position.x << "," << v.position.y << ") tex=" << (tex ? "yes" : "no");
-            dbgLog(ss.str());
-        }
-        if (tex) {
-            sf::RenderStates rs;
-            rs.blendMode = sf::BlendAlpha;
-            rs.texture = tex;
-            _groundCanvas.draw(quad, rs);
-        }
-        else {
-            _groundCanvas.draw(quad);
-        }
-    }
-    _pendingGroundQuads.clear();
+static long long groundTileKey(int tx, int ty) {
+    return (static_cast<long long>(ty) << 32) ^ static_cast<long long>(static_cast<unsigned int>(tx));
 }
 
-// Draw a quad into the persistent ground canvas (decals/stains)
-static void addQuadToGroundCanvas(const sf::VertexArray& quad, const sf::Texture* tex = nullptr) {
-    if (!_groundCanvasReady) {
-        // debug: log pending quad coords so we can see why a consistent offset may appear
-        if (quad.getVertexCount() > 0) {
-            const sf::Vertex& v = quad[0];
-            std::ostringstream ss;
-            ss << "[Explosion] queueing pending ground quad first-vertex=(" << v.position.x << "," << v.position.y << ") tex=" << (tex ? "yes" : "no");
-            dbgLog(ss.str());
-        }
-        else {
-            dbgLog("[Explosion] queueing pending ground quad (empty)");
-        }
-        // cache for later flush when canvas becomes available
-        _pendingGroundQuads.emplace_back(quad, tex);
-        return;
-    }
-    // ensure render texture uses default view so coordinates map to texture pixels
-    _groundCanvas.setView(_groundCanvas.getDefaultView());
-    if (tex) {
-        sf::RenderStates rs;
-        rs.blendMode = sf::BlendAlpha;
-        rs.texture = tex;
-        _groundCanvas.draw(quad, rs);
-    }
-    else {
-        _groundCanvas.draw(quad);
-    }
-    // do NOT call display here; batch callers should call display once after many draws
+// Find or allocate the tile at (tx, ty). Returns nullptr if the render texture can't be created.
+static GroundTile* acquireGroundTile(int tx, int ty) {
+    long long key = groundTileKey(tx, ty);
+    auto it = _groundTiles.find(key);
+    if (it != _groundTiles.end()) return &it->second;
+
+    unsigned int res = _groundHalfRes ? kGroundTileSize / 2 : kGroundTileSize;
+    std::unique_ptr<sf::RenderTexture> canvas(new sf::RenderTexture());
+    if (!createGroundCanvas(*canvas, res, res)) return nullptr;
+    canvas->setSmooth(_groundHalfRes);
+    canvas->clear(sf::Color::Transparent);
+    // The tile's view covers its world rect, so stain quads keep their world coordinates
+    float size = static_cast<float>(kGroundTileSize);
+    canvas->setView(sf::View(sf::FloatRect(tx * size, ty * size, size, size)));
+    GroundTile& tile = _groundTiles[key];
+    tile.canvas = std::move(canvas);
+    return &tile;
 }
 
-Particle::Particle() {}
-void Particle::update() {
-    // Reduced jitter (was large)  keeps particles near their computed trajectory.
-    const float jitterAmp = 0.6f;
-    float nx = (static_cast<float>(rand() % 1000) / 1000.0f - 0.5f);
-    float ny = (static_cast<float>(rand() % 1000) / 1000.0f - 0.5f);
-    _x += _vx + nx * jitterAmp;
-    _y += _vy + ny * jitterAmp;
+// Queue a quad for the persistent ground canvas (decals/stains)
+static void addQuadToGroundCanvas(const sf::Vertex* quad, const sf::Texture* tex = nullptr) {
+    sf::VertexArray& target = tex ? _pendingGroundTextured : _pendingGroundPlain;
+    for (size_t i = 0; i < 4; ++i) target.append(quad[i]);
 }
 
-Explosion::Explosion() : _vertexArray(sf::Quads, 4), _isBlood(false), _cx(0.f), _cy(0.f), _maxAllowedDrawDistance(256.f) {}
+Explosion::Explosion() : _n(0), _isBlood(false), _cx(0.f), _cy(0.f), _maxAllowedDrawDistance(256.f) {}
 
 Explosion::Explosion(float x, float y, float openAngle, float angle, float speed, float size, size_t n, bool blood)
     : _n(n),
@@ -140,7 +102,6 @@ Explosion::Explosion(float x, float y, float openAngle, float angle, float speed
     _size(size),
     _isTrace(false),
     _isBlood(blood),
-    _vertexArray(sf::Quads, 4),
     _cx(x),
     _cy(y)
 {
@@ -148,38 +109,40 @@ Explosion::Explosion(float x, float y, float openAngle, float angle, float speed
     // scale allowed draw distance with particle size (sensible clamp)
     _maxAllowedDrawDistance = std::clamp(_size * 12.0f, 128.f, 1024.f);
 
-    _particles.resize(_n);
+    _first = ParticleSystem::allocate(_n);
     for (size_t i(_n); i--;) {
-        Particle& p = _particles[i];
+        const size_t p = _first + i;
         const float sp = static_cast<float>((_max_speed > 0) ? (rand() % _max_speed) : 0);
         const float a = (static_cast<int>(rand() % static_cast<int>(openAngle * 2)) - static_cast<int>(openAngle)) * 0.0174532925f + angle;
         const int indexA = rand() % 1000;
-        p._size = static_cast<float>(rand() % int(_size) + 2);
+        const float ps = static_cast<float>(rand() % int(_size) + 2);
+        ParticleSystem::size[p] = ps;
         // place initial particle at the explosion origin (use origin, not adjusted world offsets)
-        p._x = x;
-        p._y = y - (p._size * 0.5f + 4.0f);
-        p._vx = sp * cosf(a); p._vy = sp * sinf(a);
+        ParticleSystem::x[p] = ParticleSystem::prevX[p] = x;
+        ParticleSystem::y[p] = ParticleSystem::prevY[p] = y - (ps * 0.5f + 4.0f);
+        ParticleSystem::vx[p] = sp * cosf(a) * kTuningRate; ParticleSystem::vy[p] = sp * sinf(a) * kTuningRate;
         if (!_preCalculatedVx.empty() && !_preCalculatedVy.empty()) {
-            p._vax = _preCalculatedVx[indexA]; p._vay = _preCalculatedVy[indexA];
+            ParticleSystem::dirX[p] = _preCalculatedVx[indexA]; ParticleSystem::dirY[p] = _preCalculatedVy[indexA];
         }
         else {
-            p._vax = cosf(a); p._vay = sinf(a);
+            ParticleSystem::dirX[p] = cosf(a); ParticleSystem::dirY[p] = sinf(a);
         }
         if (_isBlood) {
             uint8_t r = static_cast<uint8_t>(150 + rand() % 80);
             uint8_t g = static_cast<uint8_t>(10 + rand() % 40);
             uint8_t b = static_cast<uint8_t>(10 + rand() % 40);
             uint8_t alpha = static_cast<uint8_t>(160 + rand() % 95);
-            p._color = sf::Color(r, g, b, alpha);
+            ParticleSystem::color[p] = sf::Color(r, g, b, alpha);
         }
         else {
             uint8_t color = static_cast<uint8_t>(50 + rand() % 125);
             uint8_t alpha = static_cast<uint8_t>(100 + rand() % 155);
-            p._color = sf::Color(color, color, color, alpha);
+            ParticleSystem::color[p] = sf::Color(color, color, color, alpha);
         }
     }
     _traceOnEnd = true;
     _ratio = 1.0f;
+    _prevRatio = 1.0f;
 }
 
 Explosion::~Explosion() {}
@@ -189,181 +152,117 @@ Explosion* Explosion::add(float x, float y, float openAngle, float angle, float
     if (_preCalculatedVx.empty() || _preCalculatedVy.empty()) {
         Explosion::init();
     }
-    Explosion* e = new Explosion(x,y,openAngle,angle,speed,size,n,blood);
+    initPool();
+    if (_free.empty()) return nullptr;
+    Explosion* e = _free.back();
+    _free.pop_back();
+    *e = Explosion(x,y,openAngle,angle,speed,size,n,blood);
     _active.push_back(e);
     return e;
 }
 
+void Explosion::initPool() {
+    if (!_pool.empty()) return;
+    _pool.resize(kPoolCapacity);
+    _free.reserve(kPoolCapacity);
+    _active.reserve(kPoolCapacity);
+    for (size_t i = kPoolCapacity; i--;) _free.push_back(&_pool[i]);
+}
+
 void Explosion::setTexture(const sf::Texture& tex) {
     Explosion::_texture = tex;
 }
 
-// Allow Game to initialize ground canvas to map pixel size so decals align with world coords
-void Explosion::setGroundCanvasSize(unsigned int width, unsigned int height) {
-    if (width == 0 || height == 0) return;
-    // recreate if not ready or size differs
-    sf::Vector2u existing = _groundCanvas.getTexture().getSize();
-    if (_groundCanvasReady && existing.x == width && existing.y == height) return;
-    if (createGroundCanvas(width, height)) {
-        _groundCanvas.clear(sf::Color::Transparent);
-        _groundCanvas.display();
-        _groundCanvasReady = true;
-        // flush any quads that were queued while canvas wasn't ready
-        flushPendingGroundQuads();
-    } else {
-        _groundCanvasReady = false;
-    }
+void Explosion::clearGround() {
+    _groundTiles.clear();
+    _pendingGroundTextured.clear();
+    _pendingGroundPlain.clear();
 }
 
-void Explosion::update(void* world){
-    for (Particle& p : _particles) p.update();
-    _ratio -= _decrease;
+void Explosion::setGroundHalfResolution(bool halfRes) {
+    _groundHalfRes = halfRes;
+}
+
+size_t Explosion::getGroundTileCount() {
+    return _groundTiles.size();
+}
+
+void Explosion::update(float dt){
+    _prevRatio = _ratio;
+    _ratio -= _decrease * kTuningRate * dt;
     _ratio = std::max(0.0f, _ratio);
 }
 
-void Explosion::render(sf::RenderWindow& window) {
-    if (_ratio > 0) {
-        bool hasTex = (_isBlood && Explosion::_texture.getSize().x > 0);
-        const float maxDistSq = _maxAllowedDrawDistance * _maxAllowedDrawDistance;
-
-        for (const Particle& p : _particles) {
-            // defensive checks: ignore NaNs / huge outliers
-            if (!std::isfinite(p._x) || !std::isfinite(p._y)) {
-                std::cerr << "[Explosion] skipping particle with non-finite coords. origin=("
-                    << _cx << "," << _cy << ") particle=(" << p._x << "," << p._y << ")\n";
-                continue;
-            }
-            float dx = p._x - _cx;
-            float dy = p._y - _cy;
-            // skip particles that wandered extremely far from the explosion origin
-            if (dx * dx + dy * dy > maxDistSq) {
-                // Debug: log the outlier so we can trace why it's at a fixed offset
-                std::cerr << "[Explosion] skipping outlier particle. origin=("
-                    << _cx << "," << _cy << ") particle=(" << p._x << "," << p._y
-                    << ") dist=" << std::sqrt(dx * dx + dy * dy) << " max=" << _maxAllowedDrawDistance << "\n";
-                continue;
-            }
+void Explosion::render(sf::VertexArray& textured, sf::VertexArray& plain, bool visible) {
+    if (_ratio <= 0 || _committedToGround) return; // already stamped to ground, no longer render above entities
+
+    bool hasTex = (_isBlood && Explosion::_texture.getSize().x > 0 && Explosion::_texture.getSize().y > 0);
+    const float maxDistSq = _maxAllowedDrawDistance * _maxAllowedDrawDistance;
+    const bool commitNow = _isTrace || (_traceOnEnd && _ratio - 4 * _decrease < 0.0f);
+    // Off-screen explosions still have to hand their final quads to the ground tiles
+    if (!visible && !commitNow) return;
+
+    sf::Vector2u ts = Explosion::_texture.getSize();
+    float denom = static_cast<float>(std::max(1u, std::max(ts.x, ts.y)));
+    sf::Vector2f uv[4] = { {0.f, 0.f}, {static_cast<float>(ts.x), 0.f}, {static_cast<float>(ts.x), static_cast<float>(ts.y)}, {0.f, static_cast<float>(ts.y)} };
+    sf::Vertex quad[4];
+    // Interpolate between the last two particle ticks
+    const float alpha = _renderAlpha;
+    const float ratio = _prevRatio + (_ratio - _prevRatio) * alpha;
+    const float* px = ParticleSystem::x.data();
+    const float* py = ParticleSystem::y.data();
+    const float* ox = ParticleSystem::prevX.data();
+    const float* oy = ParticleSystem::prevY.data();
+
+    for (size_t p = _first, end = _first + _n; p < end; ++p) {
+        // defensive checks: ignore NaNs / particles that wandered extremely far from the origin
+        float x = ox[p] + (px[p] - ox[p]) * alpha;
+        float y = oy[p] + (py[p] - oy[p]) * alpha;
+        if (!std::isfinite(x) || !std::isfinite(y)) continue;
+        float dx = x - _cx;
+        float dy = y - _cy;
+        if (dx * dx + dy * dy > maxDistSq) continue;
 
-            float x = p._x;
-            float y = p._y;
+        const float psize = ParticleSystem::size[p];
+        const sf::Color& pcolor = ParticleSystem::color[p];
+        if (hasTex) {
+            float scale = (psize * ratio) / denom * 8.0f;
+            float hw = (static_cast<float>(ts.x) * scale) * 0.5f;
+            float hh = (static_cast<float>(ts.y) * scale) * 0.5f;
+            // oriented along the velocity (normalized instead of atan2 + cos/sin)
+            float c = 1.0f, sN = 0.0f;
+            float vx = ParticleSystem::vx[p], vy = ParticleSystem::vy[p];
+            float vlen = std::sqrt(vx * vx + vy * vy);
+            if (vlen > 1e-6f) { c = vx / vlen; sN = vy / vlen; }
+            sf::Vector2f local[4] = { {-hw, -hh}, {hw, -hh}, {hw, hh}, {-hw, hh} };
+            for (int i = 0; i < 4; ++i) {
+                float rx = local[i].x * c - local[i].y * sN;
+                float ry = local[i].x * sN + local[i].y * c;
+                quad[i].position = sf::Vector2f(x + rx, y + ry);
+                quad[i].texCoords = uv[i];
+                quad[i].color = pcolor;
+            }
+            if (commitNow) addQuadToGroundCanvas(quad, &_texture);
+            else for (int i = 0; i < 4; ++i) textured.append(quad[i]);
+        }
+        else {
             float sx, sy;
             if (_isTrace) {
-                int indexA = rand() % 1000;
-                sx = p._size * _ratio * getRandVx(indexA);
-                sy = p._size * _ratio * getRandVy(indexA);
-            }
-            else {
-                sx = p._size * _ratio * p._vax;
-                sy = p._size * _ratio * p._vay;
-            }
-            if (_committedToGround) continue; // already stamped to ground, no longer render above entities
-
-            if (hasTex) {
-                // [existing textured particle path  unchanged except we've already validated position]
-                sf::Sprite s(Explosion::_texture);
-                sf::Vector2u ts = Explosion::_texture.getSize();
-                if (ts.x == 0 || ts.y == 0) continue;
-                float denom = static_cast<float>(std::max(1u, std::max(ts.x, ts.y)));
-                float scale = (p._size * _ratio) / denom * 8.0f;
-                float hw = (static_cast<float>(ts.x) * scale) * 0.5f;
-                float hh = (static_cast<float>(ts.y) * scale) * 0.5f;
-                float rotDeg = std::atan2(p._vy, p._vx) * 180.f / 3.14159265f;
-                float rot = rotDeg * 3.14159265f / 180.0f;
-                float c = std::cos(rot);
-                float sN = std::sin(rot);
-                sf::Vector2f local[4] = { {-hw, -hh}, {hw, -hh}, {hw, hh}, {-hw, hh} };
-                sf::VertexArray quad(sf::Quads, 4);
-                sf::Vector2f uv[4] = { {0.f, 0.f}, {static_cast<float>(ts.x), 0.f}, {static_cast<float>(ts.x), static_cast<float>(ts.y)}, {0.f, static_cast<float>(ts.y)} };
-                for (int i = 0; i < 4; ++i) {
-                    float lx = local[i].x;
-                    float ly = local[i].y;
-                    float rx = lx * c - ly * sN;
-                    float ry = lx * sN + ly * c;
-                    quad[i].position = sf::Vector2f(x + rx, y + ry);
-                    quad[i].texCoords = uv[i];
-                    quad[i].color = p._color;
-                }
-
-                if (!_groundCanvasReady) {
-                    if (!createGroundCanvas(2560, 2560)) {
-                        _groundCanvasReady = false;
-                    }
-                    else {
-                        _groundCanvas.clear(sf::Color::Transparent);
-                        _groundCanvasReady = true;
-                        flushPendingGroundQuads();
-                    }
-                }
-
-                bool shouldCommit = false;
-                if (!_isTrace) {
-                    if (_traceOnEnd && _ratio - 4 * _decrease < 0.0f) shouldCommit = true;
-                }
-                else {
-                    shouldCommit = true;
-                }
-
-                if (shouldCommit && _groundCanvasReady) {
-                    addQuadToGroundCanvas(quad, &_texture);
-                }
-                else {
-                    s.setOrigin(static_cast<float>(ts.x) / 2.f, static_cast<float>(ts.y) / 2.f);
-                    s.setScale(scale, scale);
-                    s.setRotation(rotDeg);
-                    s.setColor(p._color);
-                    s.setPosition(x, y);
-                    window.draw(s);
-                }
+                int indexA = static_cast<int>(ParticleSystem::random(static_cast<uint32_t>(p)) % 1000U);
+                sx = psize * ratio * getRandVx(indexA);
+                sy = psize * ratio * getRandVy(indexA);
             }
             else {
-                sf::VertexArray quad(sf::Quads, 4);
-                quad[0] = sf::Vertex(sf::Vector2f(x + sx, y + sy), p._color);
-                quad[1] = sf::Vertex(sf::Vector2f(x + sy, y - sx), p._color);
-                quad[2] = sf::Vertex(sf::Vector2f(x - sx, y - sy), p._color);
-                quad[3] = sf::Vertex(sf::Vector2f(x - sy, y + sx), p._color);
-
-                // decide whether to commit to persistent ground canvas or render normally
-                if (!_isTrace)
-                {
-                    if (_traceOnEnd && _ratio - 4 * _decrease < 0.0f)
-                    {
-                        if (!_groundCanvasReady) {
-                            if (!createGroundCanvas(2560, 2560)) {
-                                _groundCanvasReady = false;
-                            }
-                            else {
-                                _groundCanvas.clear(sf::Color::Transparent);
-                                _groundCanvasReady = true;
-                                flushPendingGroundQuads();
-                            }
-                        }
-                        if (_groundCanvasReady) {
-                            addQuadToGroundCanvas(quad);
-                        }
-                        else {
-                            window.draw(quad);
-                        }
-                    }
-                    else {
-                        window.draw(quad);
-                    }
-                }
-                else
-                {
-                    if (!_groundCanvasReady) {
-                        if (!createGroundCanvas(2560, 2560)) {
-                            _groundCanvasReady = false;
-                        }
-                        else {
-                            _groundCanvas.clear(sf::Color::Transparent);
-                            _groundCanvasReady = true;
-                            flushPendingGroundQuads();
-                        }
-                    }
-                    if (_groundCanvasReady) addQuadToGroundCanvas(quad);
-                    else window.draw(quad);
-                }
+                sx = psize * ratio * ParticleSystem::dirX[p];
+                sy = psize * ratio * ParticleSystem::dirY[p];
             }
+            quad[0] = sf::Vertex(sf::Vector2f(x + sx, y + sy), pcolor);
+            quad[1] = sf::Vertex(sf::Vector2f(x + sy, y - sx), pcolor);
+            quad[2] = sf::Vertex(sf::Vector2f(x - sx, y - sy), pcolor);
+            quad[3] = sf::Vertex(sf::Vector2f(x - sy, y + sx), pcolor);
+            // decide whether to commit to persistent ground canvas or render normally
+            if (commitNow) addQuadToGroundCanvas(quad);
+            else for (int i = 0; i < 4; ++i) plain.append(quad[i]);
         }
     }
 }
@@ -373,27 +272,29 @@ void Explosion::commitToGround() {
     if (_committedToGround) return;
     bool hasTex = (_isBlood && Explosion::_texture.getSize().x > 0 && Explosion::_texture.getSize().y > 0);
     const float maxDistSq = _maxAllowedDrawDistance * _maxAllowedDrawDistance;
-    for (const Particle& p : _particles) {
-        if (!std::isfinite(p._x) || !std::isfinite(p._y)) continue;
-        float dx = p._x - _cx;
-        float dy = p._y - _cy;
+    for (size_t p = _first, end = _first + _n; p < end; ++p) {
+        float x = ParticleSystem::x[p];
+        float y = ParticleSystem::y[p];
+        if (!std::isfinite(x) || !std::isfinite(y)) continue;
+        float dx = x - _cx;
+        float dy = y - _cy;
         if (dx * dx + dy * dy > maxDistSq) continue;
 
-        float x = p._x;
-        float y = p._y;
+        const float psize = ParticleSystem::size[p];
+        const sf::Color& pcolor = ParticleSystem::color[p];
         if (hasTex) {
             sf::Vector2u ts = Explosion::_texture.getSize();
             float denom = static_cast<float>(std::max(1u, std::max(ts.x, ts.y)));
-            float scale = (p._size) / denom * 8.0f;
+            float scale = psize / denom * 8.0f;
             float hw = (static_cast<float>(ts.x) * scale) * 0.5f;
             float hh = (static_cast<float>(ts.y) * scale) * 0.5f;
-            float rotDeg = std::atan2(p._vy, p._vx) * 180.f / 3.14159265f;
-            float rot = rotDeg * 3.14159265f / 180.0f;
-            float c = std::cos(rot);
-            float sN = std::sin(rot);
+            float c = 1.0f, sN = 0.0f;
+            float vx = ParticleSystem::vx[p], vy = ParticleSystem::vy[p];
+            float vlen = std::sqrt(vx * vx + vy * vy);
+            if (vlen > 1e-6f) { c = vx / vlen; sN = vy / vlen; }
             sf::Vector2f local[4] = { {-hw, -hh}, {hw, -hh}, {hw, hh}, {-hw, hh} };
             sf::Vector2f uv[4] = { {0.f, 0.f}, {static_cast<float>(ts.x), 0.f}, {static_cast<float>(ts.x), static_cast<float>(ts.y)}, {0.f, static_cast<float>(ts.y)} };
-            sf::VertexArray quad(sf::Quads, 4);
+            sf::Vertex quad[4];
             for (int i = 0; i < 4; ++i) {
                 float lx = local[i].x;
                 float ly = local[i].y;
@@ -401,18 +302,18 @@ void Explosion::commitToGround() {
                 float ry = lx * sN + ly * c;
                 quad[i].position = sf::Vector2f(x + rx, y + ry);
                 quad[i].texCoords = uv[i];
-                quad[i].color = p._color;
+                quad[i].color = pcolor;
             }
             addQuadToGroundCanvas(quad, &Explosion::_texture);
         }
         else {
-            float sx = p._size * p._vax;
-            float sy = p._size * p._vay;
-            sf::VertexArray quad(sf::Quads, 4);
-            quad[0] = sf::Vertex(sf::Vector2f(x + sx, y + sy), p._color);
-            quad[1] = sf::Vertex(sf::Vector2f(x + sy, y - sx), p._color);
-            quad[2] = sf::Vertex(sf::Vector2f(x - sx, y - sy), p._color);
-            quad[3] = sf::Vertex(sf::Vector2f(x - sy, y + sx), p._color);
+            float sx = psize * ParticleSystem::dirX[p];
+            float sy = psize * ParticleSystem::dirY[p];
+            sf::Vertex quad[4];
+            quad[0] = sf::Vertex(sf::Vector2f(x + sx, y + sy), pcolor);
+            quad[1] = sf::Vertex(sf::Vector2f(x + sy, y - sx), pcolor);
+            quad[2] = sf::Vertex(sf::Vector2f(x - sx, y - sy), pcolor);
+            quad[3] = sf::Vertex(sf::Vector2f(x - sy, y + sx), pcolor);
             addQuadToGroundCanvas(quad, nullptr);
         }
     }
@@ -420,6 +321,7 @@ void Explosion::commitToGround() {
 }
 
 void Explosion::init(){
+    initPool();
     // idempotent init of precomputed direction vectors
     if (!_preCalculatedVx.empty() && !_preCalculatedVy.empty()) return;
     _preCalculatedVx.reserve(1000);
@@ -431,53 +333,154 @@ void Explosion::init(){
     // ensure ground canvas is initialized lazily later when needed
 }
 
+void Explosion::setTickRate(float hz) {
+    if (hz <= 0.0f) return;
+    _tickStep = 1.0f / hz;
+}
+
 void Explosion::updateAll(float dt){
-    for (int i=(int)_active.size()-1;i>=0;--i){
-        _active[i]->update(nullptr);
-        if (_active[i]->_ratio <= 0.0f){
+    _tickAccumulator += dt;
+    int ticks = 0;
+    while (_tickAccumulator >= _tickStep && ticks < kMaxTicksPerUpdate) {
+        tick(_tickStep);
+        _tickAccumulator -= _tickStep;
+        ++ticks;
+    }
+    if (ticks == kMaxTicksPerUpdate) _tickAccumulator = 0.0f;
+}
+
+void Explosion::setRenderTime(float leftover) {
+    // Time since the last particle tick = what this class holds back plus what the caller's
+    // fixed step hasn't fed in yet
+    _renderAlpha = std::clamp((_tickAccumulator + std::max(0.0f, leftover)) / _tickStep, 0.0f, 1.0f);
+}
+
+void Explosion::tick(float dt){
+    // Move every particle of every explosion in one pass, then fade the explosions
+    ParticleSystem::step(dt);
+    // Dead explosions go back to the pool and the survivors, along with their particle
+    // slices, slide down over them in the same pass. Creation order is slice order, so
+    // every move goes downward and removal stays one linear pass per tick.
+    size_t write = 0;
+    size_t particleWrite = 0;
+    for (size_t i = 0; i < _active.size(); ++i) {
+        Explosion* e = _active[i];
+        e->update(dt);
+        if (e->_ratio <= 0.0f) {
             // Automatically commit traces to the ground canvas if requested and not yet committed
-            if (_active[i]->_traceOnEnd && !_active[i]->_committedToGround) {
-                _active[i]->commitToGround();
+            if (e->_traceOnEnd && !e->_committedToGround) {
+                e->commitToGround();
             }
-            delete _active[i];
-            _active.erase(_active.begin()+i);
+            _free.push_back(e);
+            continue;
         }
+        ParticleSystem::move(e->_first, particleWrite, e->_n);
+        e->_first = particleWrite;
+        particleWrite += e->_n;
+        _active[write++] = e;
     }
+    _active.resize(write);
+    ParticleSystem::truncate(particleWrite);
 }
 
-void Explosion::renderAll(sf::RenderWindow& window){
-    for (auto e: _active) e->render(window);
+void Explosion::renderAll(sf::RenderTarget& window){
+    RenderStats::Scope statsScope(RenderStats::Subsystem::PARTICLES);
+    // Gather every live particle into one array per texture and submit each in a single draw.
+    // The arrays keep their capacity between frames so steady fire doesn't reallocate.
+    _frameTextured.clear();
+    _framePlain.clear();
+    _cullStats.reset();
+    sf::FloatRect view = viewCullRect(window, 0.0f);
+    for (auto e: _active) {
+        // particles never get further than _maxAllowedDrawDistance from the origin
+        float r = e->_maxAllowedDrawDistance;
+        bool visible = view.intersects(sf::FloatRect(e->_cx - r, e->_cy - r, r * 2.0f, r * 2.0f));
+        if (visible) ++_cullStats.drawn; else ++_cullStats.culled;
+        e->render(_frameTextured, _framePlain, visible);
+    }
+    if (_framePlain.getVertexCount() > 0) RenderStats::draw(window, _framePlain);
+    if (_frameTextured.getVertexCount() > 0) RenderStats::draw(window, _frameTextured, &Explosion::_texture);
 }
 
-void Explosion::renderGround(sf::RenderWindow& window) {
-    if (_groundCanvasReady) {
-        // compute current view rect in world coords
-        sf::View v = window.getView();
-        sf::FloatRect viewRect(v.getCenter().x - v.getSize().x*0.5f, v.getCenter().y - v.getSize().y*0.5f, v.getSize().x, v.getSize().y);
-        // texture size
-        sf::Vector2u ts = _groundCanvas.getTexture().getSize();
-        int left = static_cast<int>(std::floor(viewRect.left));
-        int top = static_cast<int>(std::floor(viewRect.top));
-        int w = static_cast<int>(std::ceil(viewRect.width));
-        int h = static_cast<int>(std::ceil(viewRect.height));
-        // clamp
-        if (left < 0) left = 0;
-        if (top < 0) top = 0;
-        if (left >= static_cast<int>(ts.x) || top >= static_cast<int>(ts.y)) {
-            // outside texture; nothing visible
-        } else {
-            if (left + w > static_cast<int>(ts.x)) w = static_cast<int>(ts.x) - left;
-            if (top + h > static_cast<int>(ts.y)) h = static_cast<int>(ts.y) - top;
-            if (w > 0 && h > 0) {
-                sf::Sprite groundSprite(_groundCanvas.getTexture());
-                groundSprite.setTextureRect(sf::IntRect(left, top, w, h));
-                // position sprite at world coordinates matching the sub-rect
-                groundSprite.setPosition(static_cast<float>(left), static_cast<float>(top));
-                // draw the ground sprite
-                window.draw(groundSprite);
+// Append every pending quad to the tiles its bounding box overlaps
+static void distributeToTiles(const sf::VertexArray& quads, bool textured, std::vector<GroundTile*>& touched) {
+    const float size = static_cast<float>(kGroundTileSize);
+    for (size_t q = 0; q + 3 < quads.getVertexCount(); q += 4) {
+        float minX = quads[q].position.x, maxX = minX;
+        float minY = quads[q].position.y, maxY = minY;
+        for (size_t i = 1; i < 4; ++i) {
+            const sf::Vector2f& v = quads[q + i].position;
+            minX = std::min(minX, v.x); maxX = std::max(maxX, v.x);
+            minY = std::min(minY, v.y); maxY = std::max(maxY, v.y);
+        }
+        int tx0 = static_cast<int>(std::floor(minX / size));
+        int tx1 = static_cast<int>(std::floor(maxX / size));
+        int ty0 = static_cast<int>(std::floor(minY / size));
+        int ty1 = static_cast<int>(std::floor(maxY / size));
+        for (int ty = ty0; ty <= ty1; ++ty) {
+            for (int tx = tx0; tx <= tx1; ++tx) {
+                GroundTile* tile = acquireGroundTile(tx, ty);
+                if (!tile) continue; // no VRAM for another tile: the stain is dropped
+                if (tile->textured.getVertexCount() == 0 && tile->plain.getVertexCount() == 0)
+                    touched.push_back(tile);
+                sf::VertexArray& dst = textured ? tile->textured : tile->plain;
+                for (size_t i = 0; i < 4; ++i) dst.append(quads[q + i]);
             }
         }
-        _groundCanvas.display();
+    }
+}
+
+void Explosion::flushGround() {
+    RenderStats::Scope statsScope(RenderStats::Subsystem::DECALS);
+    if (_pendingGroundTextured.getVertexCount() == 0 && _pendingGroundPlain.getVertexCount() == 0) return;
+
+    static std::vector<GroundTile*> touched;
+    touched.clear();
+    distributeToTiles(_pendingGroundTextured, true, touched);
+    distributeToTiles(_pendingGroundPlain, false, touched);
+
+    for (GroundTile* tile : touched) {
+        if (tile->textured.getVertexCount() > 0) {
+            sf::RenderStates rs;
+            rs.blendMode = sf::BlendAlpha;
+            rs.texture = &_texture;
+            RenderStats::draw(*tile->canvas, tile->textured, rs);
+        }
+        if (tile->plain.getVertexCount() > 0) RenderStats::draw(*tile->canvas, tile->plain);
+        tile->canvas->display();
+        tile->textured.clear();
+        tile->plain.clear();
+    }
+
+    // clear() keeps the capacity so the next fight doesn't reallocate
+    _pendingGroundTextured.clear();
+    _pendingGroundPlain.clear();
+}
+
+void Explosion::renderGround(sf::RenderTarget& window) {
+    RenderStats::Scope statsScope(RenderStats::Subsystem::DECALS);
+    if (_groundTiles.empty()) return;
+    // Only tiles overlapping the current view are drawn
+    sf::View v = window.getView();
+    sf::FloatRect viewRect(v.getCenter().x - v.getSize().x*0.5f, v.getCenter().y - v.getSize().y*0.5f, v.getSize().x, v.getSize().y);
+    const float size = static_cast<float>(kGroundTileSize);
+    int tx0 = static_cast<int>(std::floor(viewRect.left / size));
+    int tx1 = static_cast<int>(std::floor((viewRect.left + viewRect.width) / size));
+    int ty0 = static_cast<int>(std::floor(viewRect.top / size));
+    int ty1 = static_cast<int>(std::floor((viewRect.top + viewRect.height) / size));
+
+    for (int ty = ty0; ty <= ty1; ++ty) {
+        for (int tx = tx0; tx <= tx1; ++tx) {
+            auto it = _groundTiles.find(groundTileKey(tx, ty));
+            if (it == _groundTiles.end()) continue;
+            const sf::Texture& tex = it->second.canvas->getTexture();
+            sf::Sprite tileSprite(tex);
+            // half-resolution tiles are stretched back over their world rect
+            float scale = size / static_cast<float>(tex.getSize().x);
+            tileSprite.setScale(scale, scale);
+            tileSprite.setPosition(tx * size, ty * size);
+            RenderStats::draw(window, tileSprite);
+        }
     }
 }
 
@@ -1,20 +1,11 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include <vector>
+#include "ViewCulling.h"
+#include "ParticleSystem.hpp"
 
 namespace Props {
 
-    struct Particle
-    {
-        Particle();
-        void update();
-        float _x, _y;
-        float _vx, _vy;
-        float _vax, _vay;
-        float _size;
-        sf::Color _color;
-    };
-
     class Explosion
     {
     public:
@@ -23,32 +14,55 @@ namespace Props {
         ~Explosion();
 
         void initPhysics(void* world) {}
-        void update(void* world);
-        void render(sf::RenderWindow& window);
+        // Fade by dt seconds; particle motion is stepped for all explosions at once by ParticleSystem
+        void update(float dt);
+        // Append this explosion's live particles to the shared frame batches (see renderAll).
+        // When not visible only the quads due for the ground tiles are produced.
+        void render(sf::VertexArray& textured, sf::VertexArray& plain, bool visible = true);
         void setTrace(bool isTrace) { _isTrace = isTrace; }
+        // Fade per 1/120 s (the rate effects were tuned at); converted to a per-second rate internally
         void setDecrease(float d) { _decrease = d; }
+        // Max launch speed in pixels per 1/120 s, applies to particles spawned afterwards
         void setSpeed(int32_t d) { _max_speed = d; }
         void kill(void* world) {}
 
         static void init();
 
         // Static management API
+        // Takes a slot from the fixed explosion pool; returns nullptr when every slot is live
         static Explosion* add(float x, float y, float openAngle, float angle, float speed, float size, size_t n, bool blood = false);
+        // Accumulates dt and steps particles at the particle tick rate (see setTickRate)
         static void updateAll(float dt);
-        static void renderAll(sf::RenderWindow& window);
-
-        // Draw only the persistent ground canvas (call before rendering entities so stains appear under them)
-        static void renderGround(sf::RenderWindow& window);
+        // Rate particles are simulated at, independent of the physics step. Renders interpolate
+        // between the last two particle ticks, so a lower rate saves CPU without stutter.
+        static void setTickRate(float hz);
+        // Frame time not yet simulated by the caller's fixed step (its accumulator). Called once
+        // per frame before rendering so particles interpolate in frame time, like other entities.
+        static void setRenderTime(float leftover);
+        static size_t getActiveCount() { return _active.size(); }
+        static void renderAll(sf::RenderTarget& window);
+        // Explosions drawn vs. skipped by view culling in the last renderAll
+        static const CullStats& getCullStats() { return _cullStats; }
+
+        // Draw the persistent ground decal tiles inside the view (call before rendering entities so stains appear under them)
+        static void renderGround(sf::RenderTarget& window);
+        // Stamp every stain queued this frame into the ground tiles (one draw per texture,
+        // one display per touched tile). Game calls this once per frame after the fixed-step updates.
+        static void flushGround();
+        // Ground decals are kept in 512x512 world tiles allocated on demand.
+        // Half resolution stores new tiles at 256x256 (a quarter of the VRAM, softer stains).
+        static void setGroundHalfResolution(bool halfRes);
+        static void clearGround();
+        static size_t getGroundTileCount();
         // Texture support for blood particles (optional)
         static void setTexture(const sf::Texture& tex);
-        // Set ground canvas size (should be called by Game with map pixel size so decals align with world coords)
-        static void setGroundCanvasSize(unsigned int width, unsigned int height);
         // Commit remaining particles into ground canvas immediately (called on explosion end)
         void commitToGround();
 
     private:
         size_t _n;
         float  _ratio;
+        float  _prevRatio;
         float  _decrease;
         float  _openAngle;
         float  _angle;
@@ -59,8 +73,8 @@ namespace Props {
         bool   _traceOnEnd;
         bool   _isBlood;
 
-        std::vector<Particle>  _particles;
-        sf::VertexArray _vertexArray;
+        // This explosion's slice of the ParticleSystem arrays
+        size_t _first = 0;
 
         // Explosion origin (used to detect and discard outlier particles)
         float _cx = 0.f;
@@ -70,13 +84,26 @@ namespace Props {
         // tuned at construction time to scale with particle size
         float _maxAllowedDrawDistance = 256.f;
 
+        static void tick(float dt);
+
+        static float _tickStep;
+        static float _tickAccumulator;
+        static float _renderAlpha;
+        static const size_t kPoolCapacity = 1024;
+        static void initPool();
+
         static size_t _textureID;
+        // Fixed storage for every explosion; _active holds live slots in creation order
+        // (which is also particle slice order), _free the recycled ones
+        static std::vector<Explosion> _pool;
+        static std::vector<Explosion*> _free;
         static std::vector<Explosion*> _active;
         static std::vector<float> _preCalculatedVx;
         static std::vector<float> _preCalculatedVy;
 
         // optional texture used for blood particles
         static sf::Texture _texture;
+        static CullStats _cullStats;
 
         static float getRandVx(int i);
         static float getRandVy(int i);
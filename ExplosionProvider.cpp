@@ -2,8 +2,31 @@
 #include "Explosion.hpp"
 #include "Vec2.h"
 #include "Guts.hpp"
+#include "ParticleBudget.hpp"
 #include <cmath>
 
+namespace {
+    typedef ParticleBudget::Priority Priority;
+
+    // Blood burst from a pooled explosion, sized by the particle budget. nullptr when the
+    // budget dropped it or the pool is exhausted.
+    Props::Explosion* spawn(const Vec2& pos, float openAngle, float angle, float speed, float size, size_t n, float decrease, bool isTrace, Priority priority)
+    {
+        const sf::Vector2f at(pos.x, pos.y);
+        size_t granted = ParticleBudget::request(at, n, priority);
+        if (granted == 0) return nullptr;
+        Props::Explosion* e = Props::Explosion::add(pos.x, pos.y, openAngle, angle, speed, size, granted, true);
+        if (!e) {
+            ParticleBudget::reject();
+            return nullptr;
+        }
+        ParticleBudget::commit(at, n, granted, priority);
+        e->setDecrease(decrease);
+        e->setTrace(isTrace);
+        return e;
+    }
+}
+
 void ExplosionProvider::initProvider()
 {
     Props::Explosion::init();
@@ -12,72 +35,40 @@ void ExplosionProvider::initProvider()
 
 Props::Explosion* ExplosionProvider::getBase(const Vec2& pos, bool isTrace)
 {
-    Props::Explosion* e = Props::Explosion::add(pos.x, pos.y, 360.0f, 0.0f, 3.0f, 25.0f, 15, true);
-    e->setDecrease(0.05f);
-    e->setTrace(isTrace);
-
-    return e;
+    return spawn(pos, 360.0f, 0.0f, 3.0f, 25.0f, 15, 0.05f, isTrace, Priority::NORMAL);
 }
 
 Props::Explosion* ExplosionProvider::getHit(const Vec2& pos, float angle, bool isTrace)
 {
-    Props::Explosion* e = Props::Explosion::add(pos.x, pos.y, 170.0f, angle, 2.0f, 5.0f, 15, true);
-    e->setDecrease(0.05f);
-    e->setTrace(isTrace);
-
-    return e;
+    return spawn(pos, 170.0f, angle, 2.0f, 5.0f, 15, 0.05f, isTrace, Priority::NORMAL);
 }
 
 Props::Explosion* ExplosionProvider::getThrough(const Vec2& pos, float angle, bool isTrace)
 {
-    Props::Explosion* e = Props::Explosion::add(pos.x, pos.y, 1.0f, angle, 3.0f, 3.0f, 30, true);
-    e->setDecrease(0.035f);
-    e->setTrace(isTrace);
-
-    return e;
+    return spawn(pos, 1.0f, angle, 3.0f, 3.0f, 30, 0.035f, isTrace, Priority::LOW);
 }
 
 Props::Explosion* ExplosionProvider::getBigThrough(const Vec2& pos, float angle, bool isTrace)
 {
-    Props::Explosion* e = Props::Explosion::add(pos.x, pos.y, 1.0f, angle, 5.0f, 30.0f, 10, true);
-    e->setDecrease(0.25f);
-    e->setTrace(isTrace);
-
-    return e;
+    return spawn(pos, 1.0f, angle, 5.0f, 30.0f, 10, 0.25f, isTrace, Priority::LOW);
 }
 
 Props::Explosion* ExplosionProvider::getBig(const Vec2& pos, bool isTrace)
 {
-    Props::Explosion* e = Props::Explosion::add(pos.x, pos.y, 360.0f, 0.0f, 4.0f, 10.0f, 25, true);
-    e->setDecrease(0.1f);
-    e->setTrace(isTrace);
-
-    return e;
+    return spawn(pos, 360.0f, 0.0f, 4.0f, 10.0f, 25, 0.1f, isTrace, Priority::HIGH);
 }
 
 Props::Explosion* ExplosionProvider::getBigFast(const Vec2& pos, bool isTrace)
 {
-    Props::Explosion* e = Props::Explosion::add(pos.x, pos.y, 360.0f, 0.0f, 6.0f, 10.0f, 25, true);
-    e->setDecrease(0.07f);
-    e->setTrace(isTrace);
-
-    return e;
+    return spawn(pos, 360.0f, 0.0f, 6.0f, 10.0f, 25, 0.07f, isTrace, Priority::HIGH);
 }
 
 Props::Explosion* ExplosionProvider::getBigSlow(const Vec2& pos, bool isTrace)
 {
-    Props::Explosion* e = Props::Explosion::add(pos.x, pos.y, 360.0f, 0.0f, 2.0f, 70.0f, 15, true);
-    e->setDecrease(0.025f);
-    e->setTrace(isTrace);
-
-    return e;
+    return spawn(pos, 360.0f, 0.0f, 2.0f, 70.0f, 15, 0.025f, isTrace, Priority::HIGH);
 }
 
 Props::Explosion* ExplosionProvider::getClose(const Vec2& pos, float angle, bool isTrace)
 {
-    Props::Explosion* e = Props::Explosion::add(pos.x, pos.y, 170.0f, angle+3.14159265f, 20.0f, 10.0f, 50, true);
-    e->setDecrease(0.1f);
-    e->setTrace(isTrace);
-
-    return e;
+    return spawn(pos, 170.0f, angle+3.14159265f, 20.0f, 10.0f, 50, 0.1f, isTrace, Priority::NORMAL);
 }
@@ -3,6 +3,9 @@
 
 struct Vec2;
 
+// Every getter asks ParticleBudget first: kill bursts (getBig*) are kept at reduced size
+// under load, penetration trails (get*Through) are the first to go. Returns nullptr when
+// the effect was dropped or the explosion pool has no free slot.
 class ExplosionProvider {
 public:
     static void initProvider();
@@ -0,0 +1,228 @@
+#include "FlowField.h"
+#include "PhysicsWorld.h"
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <functional>
+
+namespace {
+    // Neighbour offsets (4 straight then 4 diagonal) and their step costs
+    const int kDx[8] = { 1, -1, 0, 0, 1, 1, -1, -1 };
+    const int kDy[8] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+    const float kCost[8] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.41421356f, 1.41421356f, 1.41421356f, 1.41421356f };
+    // Extra clearance around static bodies so zombies (radius ~25) don't clip corners
+    const float kObstacleClearance = 24.0f;
+}
+
+void FlowField::configure(const sf::FloatRect& worldBounds, float newCellSize) {
+    if (newCellSize <= 0.0f) return;
+    if (isConfigured() && worldBounds == bounds && newCellSize == cellSize) return;
+
+    bounds = worldBounds;
+    cellSize = newCellSize;
+    cols = std::max(1, static_cast<int>(std::ceil(bounds.width / cellSize)));
+    rows = std::max(1, static_cast<int>(std::ceil(bounds.height / cellSize)));
+
+    size_t n = static_cast<size_t>(cols) * static_cast<size_t>(rows);
+    blocked.assign(n, 0);
+    distance.assign(n, std::numeric_limits<float>::infinity());
+    dirs.assign(n, sf::Vector2f(0.f, 0.f));
+    lineOfSight.assign(n, 1);
+    open.clear();
+    open.reserve(n);
+
+    targetCell = -1;
+    searching = false;
+    obstaclesDirty = true;
+}
+
+int FlowField::cellIndexAt(float x, float y) const {
+    if (!isConfigured()) return -1;
+    int cx = static_cast<int>(std::floor((x - bounds.left) / cellSize));
+    int cy = static_cast<int>(std::floor((y - bounds.top) / cellSize));
+    if (cx < 0 || cy < 0 || cx >= cols || cy >= rows) return -1;
+    return cy * cols + cx;
+}
+
+bool FlowField::update(const sf::Vector2f& target, const PhysicsWorld* world) {
+    if (!isConfigured()) return false;
+
+    unsigned int generation = world ? world->getStaticGeneration() : 0;
+    if (generation != lastStaticGeneration) obstaclesDirty = true;
+    if (obstaclesDirty) {
+        rasterizeObstacles(world);
+        lastStaticGeneration = generation;
+        obstaclesDirty = false;
+        fieldStale = true;
+        searching = false; // the in-flight search used the old obstacles
+    }
+
+    int newTarget = cellIndexAt(target.x, target.y);
+
+    // Open ground or target off the grid: straight-line steering is already optimal, so
+    // publish an empty field without searching
+    if (!hasObstacles || newTarget < 0) {
+        searching = false;
+        if (newTarget == targetCell && !fieldStale) return false;
+        std::fill(dirs.begin(), dirs.end(), sf::Vector2f(0.f, 0.f));
+        std::fill(lineOfSight.begin(), lineOfSight.end(), static_cast<uint8_t>(1));
+        targetCell = newTarget;
+        fieldStale = false;
+        ++rebuildCount;
+        return true;
+    }
+
+    // A search in flight is finished for its own target even if the player has moved on;
+    // the next one starts right after, so the published field lags by a few updates at most
+    // and a fast-moving player can't keep restarting it.
+    if (!searching) {
+        if (newTarget == targetCell && !fieldStale) return false;
+        beginSearch(newTarget);
+    }
+    if (!advanceSearch(expansionBudget)) return false;
+
+    publishField();
+    return true;
+}
+
+void FlowField::rasterizeObstacles(const PhysicsWorld* world) {
+    std::fill(blocked.begin(), blocked.end(), static_cast<uint8_t>(0));
+    hasObstacles = false;
+    if (!world) return;
+
+    for (const PhysicsBody* b : world->staticBodies) {
+        if (!b) continue;
+        float hw = b->size.x * 0.5f + kObstacleClearance;
+        float hh = b->size.y * 0.5f + kObstacleClearance;
+        int x0 = static_cast<int>(std::floor((b->position.x - hw - bounds.left) / cellSize));
+        int x1 = static_cast<int>(std::floor((b->position.x + hw - bounds.left) / cellSize));
+        int y0 = static_cast<int>(std::floor((b->position.y - hh - bounds.top) / cellSize));
+        int y1 = static_cast<int>(std::floor((b->position.y + hh - bounds.top) / cellSize));
+        x0 = std::max(x0, 0); y0 = std::max(y0, 0);
+        x1 = std::min(x1, cols - 1); y1 = std::min(y1, rows - 1);
+        for (int y = y0; y <= y1; ++y)
+            for (int x = x0; x <= x1; ++x)
+                blocked[y * cols + x] = 1;
+        if (x0 <= x1 && y0 <= y1) hasObstacles = true;
+    }
+}
+
+void FlowField::beginSearch(int target) {
+    // Dijkstra from the target cell outward. The target cell is seeded even if blocked
+    // so a player hugging a wall still produces a usable field.
+    std::fill(distance.begin(), distance.end(), std::numeric_limits<float>::infinity());
+    open.clear();
+    distance[target] = 0.0f;
+    open.push_back(Node(0.0f, target));
+    searchTarget = target;
+    searching = true;
+}
+
+bool FlowField::advanceSearch(int budget) {
+    while (!open.empty() && budget-- > 0) {
+        std::pop_heap(open.begin(), open.end(), std::greater<Node>());
+        Node top = open.back();
+        open.pop_back();
+        int idx = top.second;
+        if (top.first > distance[idx]) continue;
+
+        int cx = idx % cols;
+        int cy = idx / cols;
+        for (int k = 0; k < 8; ++k) {
+            int nx = cx + kDx[k];
+            int ny = cy + kDy[k];
+            if (nx < 0 || ny < 0 || nx >= cols || ny >= rows) continue;
+            int nidx = ny * cols + nx;
+            if (blocked[nidx]) continue;
+            // No corner cutting: a diagonal step needs both adjacent straight cells open
+            if (k >= 4 && (blocked[cy * cols + nx] || blocked[ny * cols + cx])) continue;
+            float nd = top.first + kCost[k];
+            if (nd < distance[nidx]) {
+                distance[nidx] = nd;
+                open.push_back(Node(nd, nidx));
+                std::push_heap(open.begin(), open.end(), std::greater<Node>());
+            }
+        }
+    }
+    return open.empty();
+}
+
+void FlowField::computeLineOfSight(int target) {
+    // Visibility spreads outward ring by ring (Chebyshev distance from the target): a cell
+    // sees the target when it is open and the cells one step closer along its line do too.
+    // Requiring every candidate predecessor is conservative - a cell may be flagged hidden
+    // when a thin line would squeeze past, and then simply follows the field.
+    std::fill(lineOfSight.begin(), lineOfSight.end(), static_cast<uint8_t>(0));
+    const int tx = target % cols;
+    const int ty = target / cols;
+    lineOfSight[target] = 1;
+    const int maxR = std::max(std::max(tx, cols - 1 - tx), std::max(ty, rows - 1 - ty));
+    auto vis = [&](int x, int y) { return lineOfSight[y * cols + x] != 0; };
+    for (int r = 1; r <= maxR; ++r) {
+        // Ring corners last: they depend on their straight neighbours in the same ring
+        for (int pass = 0; pass < 2; ++pass)
+        for (int dy = -r; dy <= r; ++dy) {
+            int y = ty + dy;
+            if (y < 0 || y >= rows) continue;
+            int ady = std::abs(dy);
+            int stepX = (ady == r) ? 1 : 2 * r;
+            for (int dx = -r; dx <= r; dx += stepX) {
+                int x = tx + dx;
+                if (x < 0 || x >= cols) continue;
+                int idx = y * cols + x;
+                int adx = std::abs(dx);
+                if ((adx == ady) != (pass == 1) || blocked[idx]) continue;
+                int sx = (dx > 0) - (dx < 0);
+                int sy = (dy > 0) - (dy < 0);
+                bool v;
+                if (adx > ady) v = vis(x - sx, y) && (sy == 0 || vis(x - sx, y - sy));
+                else if (ady > adx) v = vis(x, y - sy) && (sx == 0 || vis(x - sx, y - sy));
+                else v = vis(x - sx, y - sy) && vis(x - sx, y) && vis(x, y - sy);
+                lineOfSight[idx] = v ? 1 : 0;
+            }
+        }
+    }
+}
+
+void FlowField::publishField() {
+    const float inf = std::numeric_limits<float>::infinity();
+    searching = false;
+    targetCell = searchTarget;
+    fieldStale = false;
+    ++rebuildCount;
+
+    computeLineOfSight(targetCell);
+
+    // Each reached cell that can't see the target points at its cheapest neighbour; cells
+    // that can keep their smooth direct approach instead of 8-way steps.
+    for (int cy = 0; cy < rows; ++cy) {
+        for (int cx = 0; cx < cols; ++cx) {
+            int idx = cy * cols + cx;
+            dirs[idx] = sf::Vector2f(0.f, 0.f);
+            if (idx == targetCell || distance[idx] == inf || lineOfSight[idx]) continue;
+            float best = distance[idx];
+            int bestK = -1;
+            for (int k = 0; k < 8; ++k) {
+                int nx = cx + kDx[k];
+                int ny = cy + kDy[k];
+                if (nx < 0 || ny < 0 || nx >= cols || ny >= rows) continue;
+                if (k >= 4 && (blocked[cy * cols + nx] || blocked[ny * cols + cx])) continue;
+                float d = distance[ny * cols + nx];
+                if (d < best) { best = d; bestK = k; }
+            }
+            if (bestK >= 0) {
+                float len = (bestK >= 4) ? kCost[4] : 1.0f;
+                dirs[idx] = sf::Vector2f(kDx[bestK] / len, kDy[bestK] / len);
+            }
+        }
+    }
+}
+
+bool FlowField::sample(const Vec2& pos, Vec2& outDir) const {
+    int idx = cellIndexAt(pos.x, pos.y);
+    if (idx < 0 || idx == targetCell || !hasObstacles || lineOfSight[idx]) return false;
+    const sf::Vector2f& d = dirs[idx];
+    if (d.x == 0.0f && d.y == 0.0f) return false;
+    outDir = Vec2(d.x, d.y);
+    return true;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <cstdint>
+#include "Vec2.h"
+
+class PhysicsWorld;
+
+// Grid flow field pointing every walkable cell toward a single target (the player).
+// When the target moves to a different cell (or the obstacle set changes) a Dijkstra pass
+// from the new target cell is run incrementally: a bounded number of cells is expanded per
+// update into a working buffer while zombies keep sampling the last completed field, which
+// is swapped in once the search finishes. Zombies steer by sampling their cell in O(1)
+// instead of each computing their own path.
+class FlowField {
+public:
+    FlowField() = default;
+
+    // Size the grid to cover the given world rect. Cheap no-op when nothing changed.
+    void configure(const sf::FloatRect& worldBounds, float cellSize);
+
+    // Advance the field toward the target's current cell; re-rasterizes obstacles when the
+    // world's static set changed. Returns true when a new field was completed this call.
+    bool update(const sf::Vector2f& target, const PhysicsWorld* world);
+
+    // Force obstacles to be re-rasterized on the next update (e.g. after a level load)
+    void markObstaclesDirty() { obstaclesDirty = true; }
+
+    // Cells expanded per update while a search is in flight
+    void setExpansionBudget(int cells) { expansionBudget = cells > 0 ? cells : 1; }
+
+    // Look up the steering direction for a world position. Returns false when the position
+    // is outside the grid, unreachable, already in the target cell or has a clear line to it;
+    // callers should then steer straight at the target.
+    bool sample(const Vec2& pos, Vec2& outDir) const;
+
+    bool isConfigured() const { return cols > 0 && rows > 0; }
+    float getCellSize() const { return cellSize; }
+    // Completed fields since start (each one is a full search spread over several updates)
+    int getRebuildCount() const { return rebuildCount; }
+
+private:
+    typedef std::pair<float, int> Node;
+
+    int cellIndexAt(float x, float y) const;
+    void rasterizeObstacles(const PhysicsWorld* world);
+    void beginSearch(int target);
+    // Expand up to 'budget' cells; returns true when the search has finished
+    bool advanceSearch(int budget);
+    // Turn the finished distances into directions and line-of-sight flags for sampling
+    void publishField();
+    void computeLineOfSight(int target);
+
+    sf::FloatRect bounds;
+    float cellSize = 64.0f;
+    int cols = 0;
+    int rows = 0;
+
+    std::vector<uint8_t> blocked;   // 1 = cell overlaps a static body
+    std::vector<sf::Vector2f> dirs; // normalized direction toward the next cell (0,0 = none)
+    std::vector<uint8_t> lineOfSight; // 1 = straight line to the target cell is clear
+    bool hasObstacles = false;
+    int targetCell = -1;            // target of the published field
+
+    // In-flight search (working buffer)
+    std::vector<float> distance;    // path cost to searchTarget
+    std::vector<Node> open;         // binary heap, kept allocated between searches
+    int searchTarget = -1;
+    bool searching = false;
+    int expansionBudget = 2048;
+
+    bool obstaclesDirty = true;
+    bool fieldStale = true;         // obstacles changed since the published field was built
+    unsigned int lastStaticGeneration = 0;
+    int rebuildCount = 0;
+};
@@ -0,0 +1,134 @@
+#include "FontService.h"
+#include <sstream>
+#include <algorithm>
+
+std::unordered_map<std::string, std::string> FontService::layoutCache;
+
+const std::string& FontService::defaultCharset() {
+    static const std::string chars = [] {
+        std::string s;
+        for (char c = 32; c < 127; ++c) s += c;
+        return s;
+    }();
+    return chars;
+}
+
+void FontService::prewarm(const sf::Font& font, unsigned int characterSize, bool bold, float outlineThickness, const std::string& chars) {
+    if (font.getInfo().family.empty()) return; // font failed to load
+    for (char c : chars) {
+        sf::Uint32 cp = static_cast<unsigned char>(c);
+        font.getGlyph(cp, characterSize, bold);
+        // Outlined text uses a second, separately rasterized glyph
+        if (outlineThickness > 0.f) font.getGlyph(cp, characterSize, bold, outlineThickness);
+    }
+    // Touch the page texture so it is created now rather than on first draw
+    font.getTexture(characterSize);
+}
+
+float FontService::measure(const sf::Font& font, unsigned int characterSize, const std::string& text, bool bold) {
+    float width = 0.f;
+    float lineWidth = 0.f;
+    sf::Uint32 prev = 0;
+    for (char c : text) {
+        sf::Uint32 cp = static_cast<unsigned char>(c);
+        if (cp == '\n') {
+            width = std::max(width, lineWidth);
+            lineWidth = 0.f;
+            prev = 0;
+            continue;
+        }
+        lineWidth += font.getKerning(prev, cp, characterSize, bold);
+        lineWidth += font.getGlyph(cp, characterSize, bold).advance;
+        prev = cp;
+    }
+    return std::max(width, lineWidth);
+}
+
+const std::string& FontService::wrap(const sf::Font& font, unsigned int characterSize, const std::string& text, float maxWidth, int maxLines) {
+    std::ostringstream key;
+    key << static_cast<const void*>(&font) << '|' << characterSize << '|' << maxWidth << '|' << maxLines << '|' << text;
+    std::string k = key.str();
+    auto it = layoutCache.find(k);
+    if (it != layoutCache.end()) return it->second;
+
+    if (layoutCache.size() >= kMaxCachedLayouts) layoutCache.clear();
+    return layoutCache.emplace(std::move(k), layout(font, characterSize, text, maxWidth, maxLines)).first->second;
+}
+
+std::string FontService::layout(const sf::Font& font, unsigned int characterSize, const std::string& input, float maxWidth, int maxLines) {
+    // Preserve existing paragraph breaks
+    std::istringstream paragraphStream(input);
+    std::string paragraph;
+    std::string result;
+    bool firstParagraph = true;
+    int lineCount = 0;
+    const float spaceWidth = measure(font, characterSize, " ");
+
+    auto ellipsize = [&result]() {
+        // Trim trailing whitespace and mark the cut
+        while (!result.empty() && (result.back() == '\n' || result.back() == ' ')) result.pop_back();
+        result += "...";
+    };
+
+    while (std::getline(paragraphStream, paragraph)) {
+        if (!firstParagraph) {
+            // if adding a blank line would exceed maxLines, stop
+            if (maxLines >= 0 && lineCount + 1 > maxLines) {
+                result += "...";
+                return result;
+            }
+            result += '\n';
+            lineCount += 1;
+        }
+        firstParagraph = false;
+
+        std::istringstream wordStream(paragraph);
+        std::string word;
+        std::string line;
+        float lineWidth = 0.f;
+
+        while (wordStream >> word) {
+            float wordWidth = measure(font, characterSize, word);
+            float candidateWidth = line.empty() ? wordWidth : lineWidth + spaceWidth + wordWidth;
+            if (candidateWidth <= maxWidth) {
+                line = line.empty() ? word : (line + " " + word);
+                lineWidth = candidateWidth;
+                continue;
+            }
+            if (!line.empty()) {
+                // current line is full, flush it and start new line with the word
+                if (maxLines >= 0 && lineCount + 1 > maxLines) { ellipsize(); return result; }
+                result += line + '\n';
+                lineCount += 1;
+            }
+            line.clear();
+            lineWidth = 0.f;
+            if (wordWidth <= maxWidth) {
+                line = word;
+                lineWidth = wordWidth;
+                continue;
+            }
+            // single word longer than maxWidth: break the word by characters
+            for (char c : word) {
+                float cw = measure(font, characterSize, std::string(1, c));
+                if (lineWidth + cw > maxWidth && !line.empty()) {
+                    if (maxLines >= 0 && lineCount + 1 > maxLines) { ellipsize(); return result; }
+                    result += line + '\n';
+                    lineCount += 1;
+                    line.clear();
+                    lineWidth = 0.f;
+                }
+                line += c;
+                lineWidth += cw;
+            }
+        }
+
+        if (!line.empty()) {
+            if (maxLines >= 0 && lineCount + 1 > maxLines) { ellipsize(); return result; }
+            result += line;
+            lineCount += 1;
+        }
+    }
+
+    return result;
+}
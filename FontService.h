@@ -0,0 +1,38 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <unordered_map>
+
+// Shared text helpers: glyph prewarming and cached measurement / word wrapping.
+// sf::Font rasterizes glyphs the first time a character size is used, which hitches the
+// frame a banner or menu first appears on; prewarm those sizes at load time instead.
+class FontService {
+public:
+    // Printable ASCII, used when no explicit character set is given
+    static const std::string& defaultCharset();
+
+    // Rasterize every character of `chars` at the given size/style into the font's glyph page
+    static void prewarm(const sf::Font& font, unsigned int characterSize, bool bold = false,
+                        float outlineThickness = 0.f, const std::string& chars = defaultCharset());
+
+    // Width of a single line from glyph advances and kerning (no sf::Text needed)
+    static float measure(const sf::Font& font, unsigned int characterSize, const std::string& text, bool bold = false);
+
+    // Word-wrap `text` to maxWidth, keeping existing line breaks. Words wider than a line are
+    // broken by character. With maxLines >= 0 overflowing text is cut and ends in "...".
+    // Results are cached by (text, font, size, width, maxLines).
+    static const std::string& wrap(const sf::Font& font, unsigned int characterSize, const std::string& text,
+                                   float maxWidth, int maxLines = -1);
+
+    static size_t getCachedLayoutCount() { return layoutCache.size(); }
+    static void clearLayoutCache() { layoutCache.clear(); }
+
+private:
+    static std::string layout(const sf::Font& font, unsigned int characterSize, const std::string& text,
+                              float maxWidth, int maxLines);
+
+    // Typewriter dialogs add one entry per visible prefix, so the cache is simply dropped when it grows past this
+    static const size_t kMaxCachedLayouts = 512;
+    static std::unordered_map<std::string, std::string> layoutCache;
+};
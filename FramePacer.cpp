@@ -0,0 +1,57 @@
+#include "FramePacer.h"
+#include <SFML/System.hpp>
+#include <algorithm>
+#include <thread>
+
+namespace {
+    // Wake this long before the deadline and spin the remainder
+    const std::chrono::microseconds kSpinWindow(2000);
+}
+
+void FramePacer::setVerticalSync(sf::Window& window, bool enabled) {
+    window.setVerticalSyncEnabled(enabled);
+    verticalSync = enabled;
+    hasDeadline = false;
+}
+
+void FramePacer::resetStats() {
+    totalErrorMs = 0.0;
+    worstErrorMs = 0.0;
+    pacedFrames = 0;
+    idleFrames = 0;
+}
+
+void FramePacer::wait() {
+    float fps = idleMode ? idleFps : targetFps;
+    if (fps <= 0.0f || (verticalSync && !idleMode)) {
+        hasDeadline = false;
+        return;
+    }
+    if (idleMode) ++idleFrames;
+
+    auto period = std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(1.0 / fps));
+    auto now = clock::now();
+    if (!hasDeadline) {
+        deadline = now;
+        hasDeadline = true;
+        return;
+    }
+    deadline += period;
+
+    if (now > deadline + period) {
+        // More than a whole frame behind (load hitch, breakpoint, mode switch): start a fresh
+        // schedule instead of rushing frames out to catch up
+        deadline = now;
+        return;
+    }
+
+    auto remaining = deadline - now;
+    if (remaining > kSpinWindow)
+        sf::sleep(sf::microseconds(static_cast<sf::Int64>(std::chrono::duration_cast<std::chrono::microseconds>(remaining - kSpinWindow).count())));
+    while (clock::now() < deadline) std::this_thread::yield();
+
+    double errorMs = std::chrono::duration<double, std::milli>(clock::now() - deadline).count();
+    totalErrorMs += errorMs;
+    worstErrorMs = std::max(worstErrorMs, errorMs);
+    ++pacedFrames;
+}
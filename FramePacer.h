@@ -0,0 +1,50 @@
+#pragma once
+
+#include <SFML/Window.hpp>
+#include <chrono>
+
+// Limits the main loop to a target frame rate without pinning a core: it sleeps until
+// shortly before the frame deadline (OS sleeps overshoot by a millisecond or two) and
+// spins the rest. wait() belongs at the top of the loop, before input is polled, so the
+// sleep never sits between reading input and presenting the frame.
+class FramePacer {
+public:
+    // fps <= 0 disables limiting for that mode
+    void setTargetFps(float fps) { targetFps = fps; }
+    void setIdleFps(float fps) { idleFps = fps; }
+    float getTargetFps() const { return targetFps; }
+    // Idle frames (pause menu, static menus, unfocused window) run at the idle rate
+    void setIdle(bool idle) { idleMode = idle; }
+    bool isIdle() const { return idleMode; }
+
+    // With vsync, display() already blocks on the refresh, so active frames are left to
+    // it and only idle frames are paced here
+    void setVerticalSync(sf::Window& window, bool enabled);
+    bool isVerticalSync() const { return verticalSync; }
+
+    // Block until the next frame is due
+    void wait();
+
+    // Pacing error: how late each paced frame started against its deadline
+    double getAverageErrorMs() const { return pacedFrames > 0 ? totalErrorMs / pacedFrames : 0.0; }
+    double getWorstErrorMs() const { return worstErrorMs; }
+    int getPacedFrameCount() const { return pacedFrames; }
+    int getIdleFrameCount() const { return idleFrames; }
+    void resetStats();
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    float targetFps = 60.0f;
+    float idleFps = 20.0f;
+    bool idleMode = false;
+    bool verticalSync = false;
+
+    clock::time_point deadline;
+    bool hasDeadline = false;
+
+    double totalErrorMs = 0.0;
+    double worstErrorMs = 0.0;
+    int pacedFrames = 0;
+    int idleFrames = 0;
+};
@@ -0,0 +1,92 @@
+#include "FrameScheduler.h"
+#include <chrono>
+#include <iostream>
+
+bool FrameScheduler::enqueue(const std::string& tag, Priority priority, Work work, bool oncePerFrame) {
+    if (!work) return false;
+    if (!tag.empty() && isPending(tag)) return false;
+    queues[static_cast<int>(priority)].push_back(Task{ tag, std::move(work), oncePerFrame });
+    return true;
+}
+
+bool FrameScheduler::isPending(const std::string& tag) const {
+    for (int p = 0; p < kPriorityCount; ++p) {
+        for (const Task& t : queues[p]) {
+            if (t.tag == tag) return true;
+        }
+    }
+    return false;
+}
+
+void FrameScheduler::cancel(const std::string& tag) {
+    for (int p = 0; p < kPriorityCount; ++p) {
+        for (auto it = queues[p].begin(); it != queues[p].end(); ) {
+            if (it->tag == tag) it = queues[p].erase(it);
+            else ++it;
+        }
+    }
+}
+
+int FrameScheduler::getPendingCount() const {
+    int n = 0;
+    for (int p = 0; p < kPriorityCount; ++p) n += static_cast<int>(queues[p].size());
+    return n;
+}
+
+void FrameScheduler::run() {
+    using clock = std::chrono::steady_clock;
+    auto start = clock::now();
+    lastStepCount = 0;
+    lastRunMs = 0.0;
+
+    std::string slowestTag;
+    double slowestStepMs = 0.0;
+    // Once-per-frame items that still have work, set aside until this run ends
+    std::deque<Task> parked[kPriorityCount];
+
+    while (true) {
+        // Highest priority queue with work
+        int p = 0;
+        while (p < kPriorityCount && queues[p].empty()) ++p;
+        if (p == kPriorityCount) break;
+
+        // Respect the budget, but always make some progress each frame
+        if (lastStepCount > 0 && lastRunMs >= budgetMs) break;
+
+        auto s0 = clock::now();
+        bool more = queues[p].front().work();
+        auto s1 = clock::now();
+        double stepMs = std::chrono::duration<double, std::milli>(s1 - s0).count();
+        if (stepMs > slowestStepMs) {
+            slowestStepMs = stepMs;
+            slowestTag = queues[p].front().tag;
+        }
+        // A step may enqueue more work, so only pop the front once it reports completion
+        if (!more) queues[p].pop_front();
+        else if (queues[p].front().oncePerFrame) {
+            parked[p].push_back(std::move(queues[p].front()));
+            queues[p].pop_front();
+        }
+
+        ++lastStepCount;
+        lastRunMs = std::chrono::duration<double, std::milli>(s1 - start).count();
+    }
+    // Parked items keep their place at the front of their queue for the next frame
+    for (int p = 0; p < kPriorityCount; ++p) {
+        while (!parked[p].empty()) {
+            queues[p].push_front(std::move(parked[p].back()));
+            parked[p].pop_back();
+        }
+    }
+
+    if (lastRunMs > budgetMs) {
+        double over = lastRunMs - budgetMs;
+        ++overrunCount;
+        if (over > worstOverrunMs) worstOverrunMs = over;
+        if (debugLogging) {
+            std::cout << "[FrameScheduler] budget overrun: ran " << lastRunMs << "ms (budget " << budgetMs
+                      << "ms) steps=" << lastStepCount << " slowest='" << slowestTag << "' "
+                      << slowestStepMs << "ms" << std::endl;
+        }
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <string>
+
+// Deferred work drained within a per-frame time budget.
+// Work items are small steps; a step returns true while it has more to do and is then
+// called again (possibly next frame). Higher priorities always run first. At least one
+// step runs each frame so low budgets can't starve the queue; any frame whose drain
+// exceeds the budget is counted as an overrun. Items queued as once-per-frame run at most
+// one step per frame, so their work spreads across frames regardless of spare budget.
+class FrameScheduler {
+public:
+    enum class Priority {
+        HIGH = 0,   // gameplay-visible work (zombie activation)
+        NORMAL = 1, // preparation (pool growth)
+        LOW = 2     // cosmetic (ground decal stamping)
+    };
+
+    typedef std::function<bool()> Work;
+
+    // Queue a work item. Returns false if an item with the same tag is already pending.
+    bool enqueue(const std::string& tag, Priority priority, Work work, bool oncePerFrame = false);
+    bool isPending(const std::string& tag) const;
+    // Drop a pending item (e.g. work tied to a level that was just unloaded)
+    void cancel(const std::string& tag);
+
+    // Run queued steps until the budget is spent or the queues are empty
+    void run();
+
+    void setBudgetMs(double ms) { budgetMs = ms; }
+    double getBudgetMs() const { return budgetMs; }
+    void setDebugLogging(bool enabled) { debugLogging = enabled; }
+
+    // Diagnostics (last run / running totals)
+    double getLastRunMs() const { return lastRunMs; }
+    int getLastStepCount() const { return lastStepCount; }
+    int getPendingCount() const;
+    int getOverrunCount() const { return overrunCount; }
+    double getWorstOverrunMs() const { return worstOverrunMs; }
+    void resetOverrunStats() { overrunCount = 0; worstOverrunMs = 0.0; }
+
+private:
+    struct Task {
+        std::string tag;
+        Work work;
+        bool oncePerFrame;
+    };
+
+    static const int kPriorityCount = 3;
+    std::deque<Task> queues[kPriorityCount];
+
+    double budgetMs = 2.0;
+    bool debugLogging = false;
+
+    double lastRunMs = 0.0;
+    int lastStepCount = 0;
+    int overrunCount = 0;
+    double worstOverrunMs = 0.0;
+};
@@ -2,11 +2,14 @@
 #include "Explosion.hpp"
 #include "Guts.hpp"
 #include "ExplosionProvider.hpp"
+#include "ParticleBudget.hpp"
+#include "RenderStats.h"
 #include <iostream>
 #include <algorithm>
 #include <random>
 #include <cmath>
 #include <chrono>
+#include <sstream>
 
 // Forward declaration for OBB vs AABB helper used by collision checks
 static bool obbIntersectsAabb(const sf::Vector2f& c, const sf::Vector2f& he, float rotDeg, const sf::FloatRect& aabb);
@@ -31,7 +34,10 @@ Game::Game()
     // so content isn't stretched.
     sf::VideoMode desktop = sf::VideoMode::getDesktopMode();
     window.create(desktop, "Echoes of Valkyrie", sf::Style::Fullscreen);
-    window.setFramerateLimit(60);
+    // Paced by framePacer in run() instead of SFML's limiter so idle frames can drop lower
+    framePacer.setTargetFps(60.f);
+    framePacer.setIdleFps(20.f);
+    framePacer.setVerticalSync(window, useVerticalSync);
     // Hide OS cursor; we'll draw a small dot as the custom cursor
     window.setMouseCursorVisible(false);
 
@@ -52,17 +58,9 @@ Game::Game()
     background.setFillColor(sf::Color(50, 50, 50));
     background.setSize(sf::Vector2f(2560.f, 2560.f)); // Set to map size (pixels)
 
-    if (!mapTexture1.loadFromFile("TDCod/Assets/Map/ground1.jpg")) {
+    // This texture is a single tile (512x512) repeated across the full map area (2560x2560).
+    if (!groundMaps[0].loadRepeating("TDCod/Assets/Map/ground1.jpg", getMapSize(1))) {
         std::cerr << "Error loading map1 texture!" << std::endl;
-    } else {
-        // This texture is a single tile (512x512). Enable repeating and
-        // instruct the sprite to cover the full map area (2560x2560).
-        mapTexture1.setRepeated(true);
-        mapSprite1.setTexture(mapTexture1);
-        mapSprite1.setTextureRect(sf::IntRect(0, 0, 2560, 2560));
-        int startLevelForCanvas = levelManager.getCurrentLevel();
-        sf::Vector2u initialMapSize = getMapSize(startLevelForCanvas);
-        Props::Explosion::setGroundCanvasSize(initialMapSize.x, initialMapSize.y);
     }
     
     if (!font.loadFromFile("TDCod/Assets/Call of Ops Duty.otf")) {
@@ -76,10 +74,31 @@ Game::Game()
     pointsText.setCharacterSize(24);
     pointsText.setFillColor(sf::Color::White);
     pointsText.setPosition(10, 10);
+
+    // Prewarm glyphs for the sizes our text uses so prompts, menus and end screens don't
+    // hitch the frame they first appear on. Window-relative sizes match the draw code.
+    {
+        float winH = static_cast<float>(window.getSize().y);
+        FontService::prewarm(font, 24);                                  // points
+        FontService::prewarm(font, 12, false, 0.f, "R");                 // reload key fallback
+        FontService::prewarm(font, 36);                                  // panel headers / back buttons
+        FontService::prewarm(font, 52);                                  // panel titles
+        FontService::prewarm(font, static_cast<unsigned int>(std::min(160.f, winH / 15.f)), false, 0.f, "ResumeControlsSettingsExitAy");
+        FontService::prewarm(font, static_cast<unsigned int>(std::min(300.f, winH * 0.15f)), true, 2.f, "GAME OVER");
+        FontService::prewarm(font, static_cast<unsigned int>(std::min(300.f, winH * 0.15f)), true, 3.f, "VICTORY");
+        FontService::prewarm(font, static_cast<unsigned int>(std::max(70.f, winH * 0.055f)), true, 2.f, "EXIT");
+        FontService::prewarm(font2, 12, false, 1.f, "RELOAD");
+        FontService::prewarm(font2, 18);
+        FontService::prewarm(font2, 20);
+        FontService::prewarm(font2, 24);
+        FontService::prewarm(font2, 14);                                 // F3 render stats panel
+    }
     
     physics.addBody(&player.getBody(), false);
 
     levelManager.setPhysicsWorld(&physics);
+    levelManager.setScheduler(&scheduler);
+    levelManager.setWorldOverlay(&worldOverlay);
     physics.setDebugLogging(false);
     levelManager.setDebugLogging(false);
     levelManager.initialize();
@@ -89,8 +108,6 @@ Game::Game()
         int startLevel = levelManager.getCurrentLevel();
         sf::Vector2u mapSize = getMapSize(startLevel);
         player.setPosition(static_cast<float>(mapSize.x) / 2.0f, static_cast<float>(mapSize.y) / 2.0f);
-        // Initialize explosion ground canvas to match map pixels so decals align with world coordinates
-        Props::Explosion::setGroundCanvasSize(mapSize.x, mapSize.y);
     }
 
     if (!backgroundMusic.openFromFile("TDCod/Assets/Audio/atmosphere.mp3")) {
@@ -279,76 +296,72 @@ Game::Game()
     std::array<const sf::Texture*,4> rifleSheetPtrs = { &playerRifleSheets[0], &playerRifleSheets[1], &playerRifleSheets[2], &playerRifleSheets[3] };
     player.setUpperWeaponSheet(WeaponType::RIFLE, rifleSheetPtrs, rifleFrames, rifleTimes);
 
-    // Load icon textures for pause controls panel to match scene icons
-    pauseIconTextures.clear(); pauseIconSprites.clear();
+    // HUD and menu icons are packed into shared atlas pages so the HUD draws without texture switches
     size_t totalIcons = 10; // same as scene
-    pauseIconTextures.resize(totalIcons);
-    pauseIconSprites.resize(totalIcons);
     for (size_t i = 0; i < totalIcons; ++i) {
-        std::string path = "TDCod/Scene/Assets2/Icons/icon" + std::to_string(i) + ".png";
-        if (pauseIconTextures[i].loadFromFile(path)) {
-            pauseIconTextures[i].setSmooth(true);
-            pauseIconSprites[i].setTexture(pauseIconTextures[i]);
-        } else {
-            // leave empty; panel will draw placeholder slot
-        }
-    }
-    // Load back icon (escape icon) used by the back button in the panel
-    std::string backPath = "TDCod/Scene/Assets2/Icons/esc.png";
-    if (!backIconTexture.loadFromFile(backPath)) {
-        // Not fatal; panel will draw placeholder slot instead
-    } else {
-        backIconTexture.setSmooth(true);
-        backIconSprite.setTexture(backIconTexture);
+        // missing icons leave an empty region; panel will draw placeholder slot
+        hudAtlas.add("pause" + std::to_string(i), "TDCod/Scene/Assets2/Icons/icon" + std::to_string(i) + ".png");
     }
-
-    // Load HUD weapon icons and pass to LevelManager
-    if (!pistolIconTexture.loadFromFile("TDCod/Assets/pistol_icon.png")) {
+    // Back icon (escape icon) used by the back button in the panel; not fatal if missing
+    hudAtlas.add("back", "TDCod/Scene/Assets2/Icons/esc.png");
+    if (!hudAtlas.add("pistol", "TDCod/Assets/pistol_icon.png")) {
         std::cerr << "Warning: could not load pistol icon" << std::endl;
-    } else {
-        pistolIconTexture.setSmooth(true);
-        levelManager.setPistolIcon(pistolIconTexture);
     }
-
-    if (!rifleIconTexture.loadFromFile("TDCod/Assets/rifle_icon.png")) {
+    if (!hudAtlas.add("rifle", "TDCod/Assets/rifle_icon.png")) {
         std::cerr << "Warning: could not load rifle icon" << std::endl;
-    } else {
-        rifleIconTexture.setSmooth(true);
-        levelManager.setRifleIcon(rifleIconTexture);
-    }
-
-    // Load key icons for equip buttons (optional)
-    if (keyIcon1Texture.loadFromFile("TDCod/Assets/1icon.png")) {
-        keyIcon1Texture.setSmooth(true);
-        levelManager.setKeyIcon1(keyIcon1Texture);
-    }
-    if (keyIcon2Texture.loadFromFile("TDCod/Assets/2icon.png")) {
-        keyIcon2Texture.setSmooth(true);
-        levelManager.setKeyIcon2(keyIcon2Texture);
     }
-
-    // Load R key icon for on-screen reload prompt (optional). This is non-fatal.
-    if (reloadKeyTexture.loadFromFile("TDCod/Assets/R_icon.png")) {
-        reloadKeyTexture.setSmooth(true);
-        reloadKeySprite.setTexture(reloadKeyTexture);
-        // set a default origin so positioning is straightforward when drawing
-        reloadKeySprite.setOrigin(0.f, 0.f);
+    // Key icons for equip buttons, reload prompt and tutorial dialog (optional)
+    hudAtlas.add("key1", "TDCod/Assets/1icon.png");
+    hudAtlas.add("key2", "TDCod/Assets/2icon.png");
+    hudAtlas.add("keyR", "TDCod/Assets/R_icon.png");
+    hudAtlas.add("keyEsc", "TDCod/Assets/Esc_icon.png");
+    // Placeholder tally marks for round indicators (0..4)
+    for (int i = 0; i < 5; ++i) {
+        std::string path = "TDCod/Assets/tally" + std::to_string(i) + ".png";
+        if (!hudAtlas.add("tally" + std::to_string(i), path)) {
+            std::cerr << "Warning: failed to load tally texture: " << path << std::endl;
+        }
     }
+    hudAtlas.build(true);
 
-    // Load Esc key icon for tutorial dialog (optional)
-    if (escKeyTexture.loadFromFile("TDCod/Assets/Esc_icon.png")) {
-        escKeyTexture.setSmooth(true);
-        // pass to level manager as keyIcon1 (use setter to keep ownership rules consistent)
-        levelManager.setKeyIconEsc(escKeyTexture);
+    pauseIconRegions.assign(totalIcons, TextureRegion());
+    pauseIconSprites.assign(totalIcons, sf::Sprite());
+    for (size_t i = 0; i < totalIcons; ++i) {
+        pauseIconRegions[i] = hudAtlas.get("pause" + std::to_string(i));
+        pauseIconRegions[i].applyTo(pauseIconSprites[i]);
     }
+    backIconRegion = hudAtlas.get("back");
+    backIconRegion.applyTo(backIconSprite);
+
+    levelManager.setPistolIcon(hudAtlas.get("pistol"));
+    levelManager.setRifleIcon(hudAtlas.get("rifle"));
+    levelManager.setKeyIcon1(hudAtlas.get("key1"));
+    levelManager.setKeyIcon2(hudAtlas.get("key2"));
+    levelManager.setKeyIconEsc(hudAtlas.get("keyEsc"));
+    for (int i = 0; i < 5; ++i) levelManager.setTallyTexture(i, hudAtlas.get("tally" + std::to_string(i)));
+
+    // R key icon for on-screen reload prompt (optional)
+    reloadKeyRegion = hudAtlas.get("keyR");
+    reloadKeyRegion.applyTo(reloadKeySprite);
+    // set a default origin so positioning is straightforward when drawing
+    reloadKeySprite.setOrigin(0.f, 0.f);
+    // Reload prompt labels (fixed strings, so set up once)
+    if (font2.getInfo().family.empty()) reloadPromptText.setFont(font);
+    else reloadPromptText.setFont(font2);
+    reloadPromptText.setCharacterSize(12);
+    reloadPromptText.setFillColor(sf::Color::White);
+    reloadPromptText.setOutlineColor(sf::Color::Black);
+    reloadPromptText.setOutlineThickness(1.f);
+    reloadPromptText.setString("RELOAD");
+    reloadKeyLetter.setFont(font);
+    reloadKeyLetter.setCharacterSize(12); // 60% of the prompt's 20px key box
+    reloadKeyLetter.setFillColor(sf::Color::White);
+    reloadKeyLetter.setString("R");
 
     // Load blood overlay (optional). This image should be a fullscreen PNG with transparent center.
+    // Drawn by the post-process chain, stretched to the window.
     if (bloodTexture.loadFromFile("TDCod/Assets/blood_overlay.png")) {
         bloodTexture.setSmooth(true);
-        bloodSprite.setTexture(bloodTexture);
-        bloodSprite.setPosition(0.f, 0.f);
-        // start invisible by default
-        bloodSprite.setColor(sf::Color(255,255,255,0));
     } else {
         // not fatal
         // std::cerr << "Warning: could not load blood overlay texture" << std::endl;
@@ -370,33 +383,21 @@ Game::Game()
 
     // Initialize ExplosionProvider (precomputes random tables and Guts)
     ExplosionProvider::initProvider();
-
-    // Load desaturation shader (used to grey-out world as health decreases)
-    const std::string fragShader = R"(
-        uniform sampler2D texture;
-        uniform float u_desat; // 0 = full color, 1 = grayscale
-        void main()
-        {
-            vec4 col = texture2D(texture, gl_TexCoord[0].xy);
-            float lum = dot(col.rgb, vec3(0.2126, 0.7152, 0.0722));
-            vec3 gray = vec3(lum);
-            vec3 outcol = mix(col.rgb, gray, clamp(u_desat, 0.0, 1.0));
-            gl_FragColor = vec4(outcol, col.a);
-        }
-    )";
-    desaturateShaderLoaded = desaturateShader.loadFromMemory(fragShader, sf::Shader::Fragment);
-    if (desaturateShaderLoaded) desaturateShader.setUniform("u_desat", 0.f);
-
-    // Load placeholder tally textures for round indicators (0..4)
-    for (int i = 0; i < 5; ++i) {
-        std::string path = "TDCod/Assets/tally" + std::to_string(i) + ".png";
-        if (tallyTextures[i].loadFromFile(path)) {
-            tallyTextures[i].setSmooth(true);
-            levelManager.setTallyTexture(i, tallyTextures[i]);
-        } else {
-            std::cerr << "Warning: failed to load tally texture: " << path << std::endl;
-        }
-    }
+    // Particles tick at half the physics rate; renders interpolate between their ticks
+    Props::Explosion::setTickRate(60.0f);
+    // Cap live blood particles and start thinning effects once a frame's work exceeds 60 fps
+    ParticleBudget::setMaxLiveParticles(40000);
+    ParticleBudget::setFrameBudgetMs(1000.0f / 60.0f);
+
+    // Fused desaturation + blood overlay pass (falls back to plain overlays without shaders)
+    postProcess.init();
+    // Light buffer at a quarter of the window; lower these on weak machines
+    lightMap.setBufferScale(0.25f);
+    lightMap.setMaxLights(32);
+    Props::Explosion::setGroundHalfResolution(halfResGroundDecals);
+    // Hold the 60 fps limit by shrinking the world pass during heavy fights
+    dynamicResolution.setTargetFrameMs(1000.0f / 60.0f);
+    dynamicResolution.setScaleBounds(0.6f, 1.0f);
 
     // Load UI sounds (hover and click)
     if (!uiHoverBuffer.loadFromFile("TDCod/Assets/Audio/menubutton.mp3")) {
@@ -424,11 +425,19 @@ void Game::run() {
     static double physicsTimeMs = 0.0;
     static double levelTimeMs = 0.0;
     static double renderTimeMs = 0.0;
+    static double schedulerTimeMs = 0.0;
     static uint32_t samples = 0;
     static auto windowStart = clock::now();
     const double sampleWindowSec = 5.0;
 
     while (window.isOpen()) {
+        // The pause menu only changes on input, and nothing needs 60 fps in the background
+        bool wasIdle = framePacer.isIdle();
+        framePacer.setIdle(paused || !window.hasFocus());
+        framePacer.wait();
+        RenderStats::beginFrame();
+        ParticleBudget::beginFrame(gameView);
+        auto frameStart = clock::now();
         processInput();
         float deltaTime = frameClock.restart().asSeconds();
 
@@ -462,6 +471,17 @@ void Game::run() {
         }
 
         renderAlpha = accumulator / PHYS_STEP;
+        // Particles tick slower than physics; they interpolate over the same leftover time
+        Props::Explosion::setRenderTime(renderAlpha * PHYS_STEP);
+
+        // Stamp this frame's ground stains into the decal canvas in one batch
+        Props::Explosion::flushGround();
+
+        // Drain deferred work within this frame's budget
+        auto s0 = clock::now();
+        scheduler.run();
+        auto s1 = clock::now();
+        schedulerTimeMs += std::chrono::duration<double, std::milli>(s1 - s0).count();
 
         // Measure render time
         auto r0 = clock::now();
@@ -469,6 +489,20 @@ void Game::run() {
         auto r1 = clock::now();
         renderTimeMs += std::chrono::duration<double, std::milli>(r1 - r0).count();
 
+        window.display();
+        auto d1 = clock::now();
+
+        // Pick next frame's world scale. Work excludes the pacer's wait but includes display(),
+        // where GPU fill time backs up once the driver queue is full, so the scale's own cost is
+        // part of the measurement. With vsync on display() also waits for vblank, which only
+        // makes growth more conservative.
+        float workMs = static_cast<float>(std::chrono::duration<double, std::milli>(d1 - frameStart).count());
+        // Idle frames (and the long first frame after them) say nothing about load
+        if (!wasIdle && !framePacer.isIdle()) {
+            dynamicResolution.update(deltaTime * 1000.0f, workMs);
+            ParticleBudget::setFrameTime(workMs);
+        }
+
         // Count this frame as a sample
         samples++;
 
@@ -479,12 +513,49 @@ void Game::run() {
             double avgPhysics = (samples > 0) ? physicsTimeMs / samples : 0.0;
             double avgLevel = (samples > 0) ? levelTimeMs / samples : 0.0;
             double avgRender = (samples > 0) ? renderTimeMs / samples : 0.0;
+            double avgScheduler = (samples > 0) ? schedulerTimeMs / samples : 0.0;
             std::cout << "[Profiler] samples=" << samples
                       << " avgPhysics(ms)=" << avgPhysics
                       << " avgLevel(ms)=" << avgLevel
                       << " avgRender(ms)=" << avgRender
+                      << " avgDeferred(ms)=" << avgScheduler
+                      << " deferredPending=" << scheduler.getPendingCount()
+                      << " budgetOverruns=" << scheduler.getOverrunCount()
+                      << " worstOverrun(ms)=" << scheduler.getWorstOverrunMs()
                       << " activeZombies=" << levelManager.getActiveZombieCount()
-                      << " queuedZombies=" << levelManager.getQueuedZombieCount();
+                      << " queuedZombies=" << levelManager.getQueuedZombieCount()
+                      << " decalTiles=" << Props::Explosion::getGroundTileCount()
+                      << " groundTextures=" << (activeGround ? activeGround->getResidentTextureCount() : 0)
+                      << " flowFields=" << levelManager.getFlowFieldRebuildCount()
+                      << " lod(full/reduced/kinematic)=" << levelManager.getLodCount(ZombieLod::FULL) << "/" << levelManager.getLodCount(ZombieLod::REDUCED)
+                      << "/" << levelManager.getLodCount(ZombieLod::KINEMATIC)
+                      << " drawn/culled zombies=" << levelManager.getZombieCullStats().drawn << "/" << levelManager.getZombieCullStats().culled
+                      << " bullets=" << levelManager.getBulletCullStats().drawn << "/" << levelManager.getBulletCullStats().culled
+                      << " bulletBatch(draws/quads)=" << levelManager.getWorldBatch().getLastDrawCalls() << "/" << levelManager.getWorldBatch().getLastQuadCount()
+                      << " explosions=" << Props::Explosion::getCullStats().drawn << "/" << Props::Explosion::getCullStats().culled
+                      << " particles=" << Props::ParticleSystem::getLiveCount()
+                      << " effects(spawn/scaled/dropped)=" << ParticleBudget::getStats().spawned << "/" << ParticleBudget::getStats().scaled
+                      << "/" << ParticleBudget::getStats().dropped
+                      << " guts=" << Guts::getCullStats().drawn << "/" << Guts::getCullStats().culled
+                      << " postFxFrames=" << postProcess.getOffscreenFrameCount()
+                      << " overlayDraws(world/aim)=" << worldOverlay.getLastDrawCalls() << "/" << aimOverlay.getLastDrawCalls()
+                      << " lights=" << lightMap.getLastLightCount() << "/" << lightMap.getDroppedLightCount()
+                      << " worldScale=" << dynamicResolution.getScale()
+                      << " scaleChanges=" << dynamicResolution.getChangeCount()
+                      << " paceErr(ms)=" << framePacer.getAverageErrorMs() << "/" << framePacer.getWorstErrorMs()
+                      << " idleFrames=" << framePacer.getIdleFrameCount();
+            int statFrames = std::max(1, RenderStats::getWindowFrames());
+            RenderStats::Counters rs = RenderStats::getWindowTotal();
+            std::cout << " perFrame[draws=" << rs.drawCalls / statFrames
+                      << " verts=" << rs.vertices / statFrames
+                      << " texSw=" << rs.textureSwitches / statFrames
+                      << " shaderSw=" << rs.shaderSwitches / statFrames
+                      << " rtSw=" << rs.targetSwitches / statFrames << "] draws[";
+            for (int i = 0; i < static_cast<int>(RenderStats::Subsystem::COUNT); ++i) {
+                RenderStats::Subsystem s = static_cast<RenderStats::Subsystem>(i);
+                std::cout << (i ? " " : "") << RenderStats::getName(s) << "=" << RenderStats::getWindow(s).drawCalls / statFrames;
+            }
+            std::cout << "]";
             if (&physics) {
                 std::cout << " physicsBodies=" << physics.getDynamicBodyCount()
                           << " lastChecks=" << physics.getLastCollisionChecks();
@@ -496,6 +567,13 @@ void Game::run() {
             physicsTimeMs = 0.0;
             levelTimeMs = 0.0;
             renderTimeMs = 0.0;
+            schedulerTimeMs = 0.0;
+            scheduler.resetOverrunStats();
+            postProcess.resetStats();
+            dynamicResolution.resetStats();
+            framePacer.resetStats();
+            ParticleBudget::resetStats();
+            RenderStats::resetWindow();
             windowStart = now;
         }
     }
@@ -545,6 +623,7 @@ void Game::processInput() {
                 if (!levelManager.isRequireEscToAdvanceDialog()) levelManager.advanceDialog();
             }
             if (event.key.code == sf::Keyboard::R) player.startReload();
+            if (event.key.code == sf::Keyboard::F3) showRenderStats = !showRenderStats;
             //if (event.key.code == sf::Keyboard::Tilde) debugDrawHitboxes = !debugDrawHitboxes;
             if (event.key.code == sf::Keyboard::Num1) player.setWeapon(WeaponType::RIFLE);
             if (event.key.code == sf::Keyboard::Num2) player.setWeapon(WeaponType::PISTOL);
@@ -812,6 +891,7 @@ void Game::update(float deltaTime) {
     sf::Vector2f vs = gameView.getSize();
     sf::FloatRect viewRect(vc.x - vs.x/2.0f, vc.y - vs.y/2.0f, vs.x, vs.y);
     levelManager.setCameraViewRect(viewRect);
+    levelManager.setWorldSize(mapSize);
 
     // Automatic fire for rifle: allow continuous shooting while left mouse button is held.
     // Pistol remains single-shot
@@ -919,7 +999,7 @@ void Game::drawVictoryScreen() {
     sf::FloatRect tbTitle = title.getLocalBounds();
     title.setOrigin(tbTitle.left + tbTitle.width * 0.5f, tbTitle.top + tbTitle.height * 0.5f);
     title.setPosition(static_cast<float>(windowSize.x) * 0.5f, static_cast<float>(windowSize.y) * 0.34f);
-    window.draw(title);
+    RenderStats::draw(window, title);
 
     // Label
     sf::Text exitText;
@@ -970,18 +1050,38 @@ void Game::drawVictoryScreen() {
     // Tint and scale the text when hovered (no box)
     exitText.setScale(finalScale, finalScale);
     exitText.setFillColor(hovered ? sf::Color::Yellow : sf::Color::White);
-    window.draw(exitText);
+    RenderStats::draw(window, exitText);
 }
 
 void Game::render() {
     window.clear();
-    window.setView(gameView);
+
+    // Screen-space effects follow health: the world greys out and the blood overlay
+    // intensifies as it falls. Near full health both are neutral and the chain lets
+    // the world draw straight to the window.
+    float healthPercent = 1.0f;
+    if (player.getMaxHealth() > 0.0f) healthPercent = std::clamp(player.getCurrentHealth() / player.getMaxHealth(), 0.0f, 1.0f);
+    // non-linear ramps (increase toward low health); desaturatePow > bloodIntensityPow so grey lags the blood
+    float desatAmount = std::clamp(std::pow(1.0f - healthPercent, desaturatePow), 0.0f, 1.0f);
+    float bloodT = std::clamp(std::pow(1.0f - healthPercent, bloodIntensityPow), 0.0f, 1.0f);
+    postProcess.setDesaturation(desatAmount * desaturateMaxStrength);
+    postProcess.setBloodOverlay(&bloodTexture, bloodMaxAlpha * bloodT / 255.0f);
+    postProcess.setRenderScale(dynamicResolution.getScale());
+
+    sf::RenderTarget& world = postProcess.begin(window, gameView);
 
     if (!levelManager.isLevelTransitioning()) {
         int currentLevel = levelManager.getCurrentLevel();
-        window.draw(getMapSprite(currentLevel));
+        GroundMap& ground = getGroundMap(currentLevel);
+        if (&ground != activeGround) {
+            // Left the previous map: free its texture so only one level's ground is resident
+            if (activeGround) activeGround->release();
+            activeGround = &ground;
+        }
+        ground.update();
+        ground.draw(world);
         // draw persistent ground decals (stains) under entities
-        Props::Explosion::renderGround(window);
+        Props::Explosion::renderGround(world);
         
         // Set interpolation alpha for player and zombies before they are rendered
         player.setRenderAlpha(renderAlpha);
@@ -990,8 +1090,11 @@ void Game::render() {
             z->setRenderAlpha(renderAlpha);
         }
 
-        // Render the full level (tiles, zombies, props) so zombies are visible
-        levelManager.render(window);
+        // Zombies and the player go through one y-sorted queue so whoever is lower on screen
+        // overlaps; depths are quantized over the culled view
+        sf::FloatRect depthRange = viewCullRect(world, 256.f);
+        renderQueue.begin(depthRange.top, depthRange.height);
+        levelManager.render(world, renderQueue);
 
         // Draw spread cone under the player upper sprite (world-space)
         // Skip drawing if player is dead
@@ -1008,150 +1111,100 @@ void Game::render() {
                 sf::Vector2f leftP(muzzlePos.x + std::cos(baseRad - spreadRad) * coneLen, muzzlePos.y + std::sin(baseRad - spreadRad) * coneLen);
                 sf::Vector2f rightP(muzzlePos.x + std::cos(baseRad + spreadRad) * coneLen, muzzlePos.y + std::sin(baseRad + spreadRad) * coneLen);
 
-                sf::VertexArray fan(sf::TriangleFan);
                 sf::Color centerC(255,255,255,120);
                 sf::Color outerC(255,255,255,16);
-                fan.append(sf::Vertex(muzzlePos, centerC));
-                fan.append(sf::Vertex(leftP, outerC));
-                fan.append(sf::Vertex(rightP, outerC));
-                window.draw(fan);
-
-                sf::Vertex side1[2] = { sf::Vertex(muzzlePos, sf::Color(255,255,255,120)), sf::Vertex(leftP, sf::Color(255,255,255,80)) };
-                sf::Vertex side2[2] = { sf::Vertex(muzzlePos, sf::Color(255,255,255,120)), sf::Vertex(rightP, sf::Color(255,255,255,80)) };
-                window.draw(side1, 2, sf::Lines);
-                window.draw(side2, 2, sf::Lines);
+                aimOverlay.addTriangle(muzzlePos, leftP, rightP, centerC, outerC, outerC);
+                aimOverlay.addLine(muzzlePos, leftP, sf::Color(255,255,255,120), sf::Color(255,255,255,80));
+                aimOverlay.addLine(muzzlePos, rightP, sf::Color(255,255,255,120), sf::Color(255,255,255,80));
+            }
+        }
+
+        // Reload prompt panel under the player if they are out of ammo and not currently reloading
+        bool showReloadPrompt = player.getCurrentAmmo() <= 0 && !player.isReloading();
+        sf::Vector2f ppos = player.getPosition();
+        // Panel dimensions in world space
+        const float panelW = 95.f;
+        const float panelH = 28.f;
+        const float yOffset = 54.f; // distance below player
+        const float iconPad = 8.f;
+        const float iconH = panelH * 0.72f;
+        const float iconX = ppos.x - panelW * 0.5f + iconPad;
+        bool hasKeyIcon = reloadKeyRegion.valid();
+        if (showReloadPrompt) {
+            sf::FloatRect panelRect(ppos.x - panelW * 0.5f, ppos.y + yOffset - panelH * 0.5f, panelW, panelH);
+            // Use a more transparent background so it doesn't block the view, with a softer outline
+            worldOverlay.addRect(panelRect, sf::Color(0, 0, 0, 120));
+            worldOverlay.addRectOutline(panelRect, 1.5f, sf::Color(255, 255, 255, 140));
+            if (!hasKeyIcon) {
+                // fallback: draw a simple 'R' box
+                sf::FloatRect keyRect(iconX, ppos.y + yOffset - panelH * 0.5f + (panelH - iconH) * 0.5f, iconH, iconH);
+                worldOverlay.addRect(keyRect, sf::Color(30,30,30,140));
+                worldOverlay.addRectOutline(keyRect, 1.f, sf::Color(255,255,255,140));
             }
         }
 
         // Sync player's debug origins flag with global debug toggle so muzzle markers follow backtick
         player.debugDrawOrigins = debugDrawHitboxes;
-        player.render(window);
-        // Now draw bullets so they appear over the player sprite
-        levelManager.renderBullets(window, bullets, renderAlpha);
-
-        // Draw reload prompt panel under the player if they are out of ammo and not currently reloading
-        if (player.getCurrentAmmo() <= 0 && !player.isReloading()) {
-            sf::Vector2f ppos = player.getPosition();
-            // Panel dimensions in world space
-            float panelW = 95.f;
-            float panelH = 28.f;
-            float yOffset = 54.f; // distance below player
-
-            sf::RectangleShape panel(sf::Vector2f(panelW, panelH));
-            panel.setOrigin(panelW * 0.5f, panelH * 0.5f);
-            panel.setPosition(ppos.x, ppos.y + yOffset);
-            // Use a more transparent background so it doesn't block the view
-            panel.setFillColor(sf::Color(0, 0, 0, 120));
-            // Softer outline
-            panel.setOutlineColor(sf::Color(255, 255, 255, 140));
-            panel.setOutlineThickness(1.5f);
-            window.draw(panel);
-
+        // Aim cone directly under the player, player at its depth among the zombies
+        renderQueue.submit(RenderQueue::Layer::ENTITIES, ppos.y, 0, [this](sf::RenderTarget& t) { aimOverlay.flush(t); });
+        renderQueue.submit(RenderQueue::Layer::ENTITIES, ppos.y, 1, [this](sf::RenderTarget& t) { player.render(t); });
+        renderQueue.flush(world);
+
+        // Lights multiply over the ground and entities only; overlays, bullets and
+        // particles below stay at full brightness
+        lightMap.setAmbient(getAmbientLight(currentLevel));
+        if (lightMap.getAmbient() != sf::Color(128, 128, 128))
+            lightMap.addLight(ppos, playerLightRadius, sf::Color(90, 85, 70));
+        player.submitLights(lightMap);
+        lightMap.apply(world);
+
+        // Health bars and prompt panel above every entity, in one go
+        worldOverlay.flush(world);
+
+        if (showReloadPrompt) {
+            RenderStats::Scope promptScope(RenderStats::Subsystem::OVERLAY);
             // Draw key icon on left (if available)
-            float iconPad = 8.f;
-            float iconH = panelH * 0.72f;
-            if (reloadKeyTexture.getSize().x > 0 && reloadKeySprite.getTexture() != nullptr) {
-                sf::Sprite ks = reloadKeySprite;
-                sf::Vector2u kts = reloadKeyTexture.getSize();
+            if (hasKeyIcon) {
+                sf::Vector2u kts = reloadKeyRegion.getSize();
                 float scale = iconH / static_cast<float>(kts.y);
-                ks.setScale(scale, scale);
-                float iconX = ppos.x - panelW * 0.5f + iconPad;
+                reloadKeySprite.setScale(scale, scale);
                 float iconY = ppos.y + yOffset - panelH * 0.5f + (panelH - kts.y * scale) * 0.5f;
-                ks.setPosition(iconX, iconY);
-                window.draw(ks);
+                reloadKeySprite.setPosition(iconX, iconY);
+                RenderStats::draw(world, reloadKeySprite);
             } else {
-                // fallback: draw a simple 'R' box
-                sf::RectangleShape keyBox(sf::Vector2f(iconH, iconH));
-                keyBox.setFillColor(sf::Color(30,30,30,140));
-                keyBox.setOutlineColor(sf::Color(255,255,255,140));
-                keyBox.setOutlineThickness(1.f);
-                float iconX = ppos.x - panelW * 0.5f + iconPad;
                 float iconY = ppos.y + yOffset - panelH * 0.5f + (panelH - iconH) * 0.5f;
-                keyBox.setPosition(iconX, iconY);
-                window.draw(keyBox);
-                sf::Text keyLetter;
-                keyLetter.setFont(font);
-                keyLetter.setCharacterSize(static_cast<unsigned int>(iconH * 0.6f));
-                keyLetter.setFillColor(sf::Color::White);
-                keyLetter.setString("R");
-                sf::FloatRect kb = keyLetter.getLocalBounds();
-                keyLetter.setPosition(iconX + (iconH - kb.width) * 0.5f - kb.left, iconY + (iconH - kb.height) * 0.5f - kb.top);
-                window.draw(keyLetter);
+                sf::FloatRect kb = reloadKeyLetter.getLocalBounds();
+                reloadKeyLetter.setPosition(iconX + (iconH - kb.width) * 0.5f - kb.left, iconY + (iconH - kb.height) * 0.5f - kb.top);
+                RenderStats::draw(world, reloadKeyLetter);
             }
 
             // Draw reload prompt text to the right of the icon
-            sf::Text reloadText;
-            if (font2.getInfo().family.empty()) reloadText.setFont(font);
-            else reloadText.setFont(font2);
-            reloadText.setCharacterSize(12);
-            reloadText.setFillColor(sf::Color::White);
-            reloadText.setOutlineColor(sf::Color::Black);
-            reloadText.setOutlineThickness(1.f);
-            reloadText.setString("RELOAD");
-            // compute text position
-            float textX = ppos.x - panelW * 0.5f + iconPad + iconH + 8.f;
-            float textY = ppos.y + yOffset - panelH * 0.5f + (panelH - reloadText.getLocalBounds().height) * 0.5f - reloadText.getLocalBounds().top;
-            reloadText.setPosition(textX, textY);
-            window.draw(reloadText);
+            sf::FloatRect tb = reloadPromptText.getLocalBounds();
+            float textX = iconX + iconH + 8.f;
+            float textY = ppos.y + yOffset - panelH * 0.5f + (panelH - tb.height) * 0.5f - tb.top;
+            reloadPromptText.setPosition(textX, textY);
+            RenderStats::draw(world, reloadPromptText);
         }
 
+        // Now draw bullets so they appear over the player sprite
+        levelManager.renderBullets(world, bullets, renderAlpha);
+
         // Draw explosions and guts splatters (world-space) AFTER entities so airborne particles appear above zombies
         // They use world coordinates, so keep the gameView when rendering them.
-        Props::Explosion::renderAll(window);
-        Guts::renderAll(window);
+        Props::Explosion::renderAll(world);
+        Guts::renderAll(world);
     }
 
-    // Draw world-space overlays (HUD/UI) using default view
-    window.setView(window.getDefaultView());
-
-    // Apply a simple grayscale overlay to desaturate the world (keeps UI and blood overlay unaffected).
-    float healthPercent = 1.0f;
-    if (player.getMaxHealth() > 0.0f) healthPercent = std::clamp(player.getCurrentHealth() / player.getMaxHealth(), 0.0f, 1.0f);
-    // non-linear ramp for desaturation (increase toward low health)
-    // Use desaturatePow to slow the ramp: t = (1 - health)^desaturatePow
-    float desatAmount = std::pow(1.0f - healthPercent, desaturatePow);
-    desatAmount = std::clamp(desatAmount, 0.0f, 1.0f);
-    if (desatAmount > 0.001f) {
-        // Reduce maximum strength so it never becomes too gray. Use a lighter base and lower max alpha.
-        const float MAX_ALPHA = 100.0f; // slightly lower for smoother ramp
-        sf::Uint8 a = static_cast<sf::Uint8>(std::clamp(desatAmount * MAX_ALPHA, 0.0f, MAX_ALPHA));
-        sf::RectangleShape desatRect(sf::Vector2f(static_cast<float>(window.getSize().x), static_cast<float>(window.getSize().y)));
-        // Use a lighter gray so the effect is subtle
-        desatRect.setFillColor(sf::Color(180,180,180,a));
-        desatRect.setPosition(0.f, 0.f);
-        window.draw(desatRect);
-    }
-
-    // Draw blood overlay (screen-space) based on player's health (below UI)
-    if (bloodTexture.getSize().x > 0) {
-        float healthPercent = 1.0f;
-        if (player.getMaxHealth() > 0.0f) healthPercent = std::clamp(player.getCurrentHealth() / player.getMaxHealth(), 0.0f, 1.0f);
-        // intensity grows as health decreases.
-        float t = std::pow(1.0f - healthPercent, bloodIntensityPow);
-        t = std::clamp(t, 0.0f, 1.0f);
-        float alphaF = bloodMaxAlpha * t; // 0..bloodMaxAlpha
-        sf::Uint8 a = static_cast<sf::Uint8>(std::clamp(alphaF, 0.0f, 255.0f));
-        bloodSprite.setColor(sf::Color(255,255,255,a));
-        // scale sprite to cover current window size
-        sf::Vector2u ts = bloodTexture.getSize();
-        if (ts.x > 0 && ts.y > 0) {
-            float sx = static_cast<float>(window.getSize().x) / static_cast<float>(ts.x);
-            float sy = static_cast<float>(window.getSize().y) / static_cast<float>(ts.y);
-            bloodSprite.setScale(sx, sy);
-            bloodSprite.setPosition(0.f, 0.f);
-            window.draw(bloodSprite);
-        }
-    }
-
-    // Draw explosions and guts splatters (world-space) AFTER entities so airborne particles appear above zombies
-    // They use world coordinates, so keep the gameView when rendering them.
-    Props::Explosion::renderAll(window);
-    Guts::renderAll(window);
+    // Composite the world onto the window (fused desaturation + blood pass when active).
+    // Leaves the default view set for the HUD/UI below.
+    postProcess.end(window);
 
     // Draw zombie count in top-left corner
     levelManager.renderUI(window, font);
     levelManager.drawHUD(window, player);
 
+    // Everything below is end screens, cursor and pause menu
+    RenderStats::Scope menuScope(RenderStats::Subsystem::MENUS);
     if (levelManager.getCurrentState() == GameState::VICTORY) {
         // Ensure UI/default view is active
         window.setView(window.getDefaultView());
@@ -1175,7 +1228,7 @@ void Game::render() {
             cursorDot.setFillColor(sf::Color::White);
             cursorDot.setOutlineColor(sf::Color::Black);
             cursorDot.setOutlineThickness(0.5f);
-            window.draw(cursorDot);
+            RenderStats::draw(window, cursorDot);
         }
     }
 
@@ -1183,7 +1236,7 @@ void Game::render() {
     if (paused) {
         sf::RectangleShape overlay(sf::Vector2f(static_cast<float>(window.getSize().x), static_cast<float>(window.getSize().y)));
         overlay.setFillColor(sf::Color(0, 0, 0, 140));
-        window.draw(overlay);
+        RenderStats::draw(window, overlay);
 
         // Draw simple vertical text list: Resume, Controls, Settings, Exit (no button boxes)
         std::vector<std::string> labels = {"Resume", "Controls", "Settings", "Exit"};
@@ -1249,7 +1302,7 @@ void Game::render() {
             float tx = centerX - (tb.left + tb.width / 2.f);
             float ty = startY + static_cast<float>(i) * (lineH + spacing) + lineH * 0.5f - tb.top;
             t.setPosition(tx, ty);
-            window.draw(t);
+            RenderStats::draw(window, t);
         }
     }
 
@@ -1267,7 +1320,7 @@ void Game::render() {
         const float PANEL_EXTRA_OFFSET = 80.f;
         float panelCenterY = titleBottom + gap + PANEL_EXTRA_OFFSET + panel.getSize().y / 2.f;
         panel.setPosition(window.getSize().x/2.f, panelCenterY);
-        window.draw(panel);
+        RenderStats::draw(window, panel);
 
         sf::Text title;
         title.setFont(font); title.setCharacterSize(52); title.setFillColor(sf::Color::White);
@@ -1275,7 +1328,7 @@ void Game::render() {
         sf::FloatRect tbb = title.getLocalBounds();
         title.setOrigin(tbb.left + tbb.width/2.f, tbb.top + tbb.height/2.f);
         title.setPosition(panel.getPosition().x, panel.getPosition().y - panel.getSize().y/2.f + 40.f);
-        window.draw(title);
+        RenderStats::draw(window, title);
 
         // Draw a short separator line below the title with fade to transparent at the edges (matches scene.cpp)
         {
@@ -1299,7 +1352,7 @@ void Game::render() {
                 sf::RectangleShape centerRect(sf::Vector2f(centerRight - centerLeft, sepThickness));
                 centerRect.setPosition(centerLeft, yTop);
                 centerRect.setFillColor(colOpaque);
-                window.draw(centerRect);
+                RenderStats::draw(window, centerRect);
             }
 
             // left fading quad (two triangles)
@@ -1311,7 +1364,7 @@ void Game::render() {
                 leftGrad[3] = sf::Vertex(sf::Vector2f(xL, yTop), colTransparent);
                 leftGrad[4] = sf::Vertex(sf::Vector2f(centerLeft, yBottom), colOpaque);
                 leftGrad[5] = sf::Vertex(sf::Vector2f(xL, yBottom), colTransparent);
-                window.draw(leftGrad);
+                RenderStats::draw(window, leftGrad);
             }
 
             // right fading quad (two triangles)
@@ -1323,7 +1376,7 @@ void Game::render() {
                 rightGrad[3] = sf::Vertex(sf::Vector2f(centerRight, yTop), colOpaque);
                 rightGrad[4] = sf::Vertex(sf::Vector2f(xR, yBottom), colTransparent);
                 rightGrad[5] = sf::Vertex(sf::Vector2f(centerRight, yBottom), colOpaque);
-                window.draw(rightGrad);
+                RenderStats::draw(window, rightGrad);
             }
         }
 
@@ -1347,12 +1400,12 @@ void Game::render() {
         sf::Text leftHeader; leftHeader.setFont(font); leftHeader.setCharacterSize(36); leftHeader.setFillColor(sf::Color::White); leftHeader.setString("Movement");
         sf::FloatRect lh = leftHeader.getLocalBounds(); leftHeader.setOrigin(lh.left + lh.width/2.f, lh.top + lh.height/2.f);
         leftHeader.setPosition(leftColX + colWidth * 0.25f, headerY);
-        window.draw(leftHeader);
+        RenderStats::draw(window, leftHeader);
 
         sf::Text rightHeader; rightHeader.setFont(font); rightHeader.setCharacterSize(36); rightHeader.setFillColor(sf::Color::White); rightHeader.setString("Combat");
         sf::FloatRect rh = rightHeader.getLocalBounds(); rightHeader.setOrigin(rh.left + rh.width/2.f, rh.top + rh.height/2.f);
         rightHeader.setPosition(rightColX + colWidth * 0.25f, headerY);
-        window.draw(rightHeader);
+        RenderStats::draw(window, rightHeader);
 
         float startY = headerY + 24.f;
         // Shift content (bars, icons, vertical separators) downward between
@@ -1379,7 +1432,7 @@ void Game::render() {
                 sf::RectangleShape centerRect(sf::Vector2f(centerR - centerL, thickness));
                 centerRect.setPosition(centerL, y);
                 centerRect.setFillColor(colOpaque);
-                window.draw(centerRect);
+                RenderStats::draw(window, centerRect);
             }
 
             // left fading quad (two triangles)
@@ -1391,7 +1444,7 @@ void Game::render() {
                 leftGrad[3] = sf::Vertex(sf::Vector2f(xLeft, y), colTransparent);
                 leftGrad[4] = sf::Vertex(sf::Vector2f(centerL, y + thickness), colOpaque);
                 leftGrad[5] = sf::Vertex(sf::Vector2f(xLeft, y + thickness), colTransparent);
-                window.draw(leftGrad);
+                RenderStats::draw(window, leftGrad);
             }
 
             // right fading quad (two triangles)
@@ -1403,7 +1456,7 @@ void Game::render() {
                 rightGrad[3] = sf::Vertex(sf::Vector2f(centerR, y), colOpaque);
                 rightGrad[4] = sf::Vertex(sf::Vector2f(xRight, y + thickness), colTransparent);
                 rightGrad[5] = sf::Vertex(sf::Vector2f(centerR, y + thickness), colOpaque);
-                window.draw(rightGrad);
+                RenderStats::draw(window, rightGrad);
             }
         };
 
@@ -1424,7 +1477,7 @@ void Game::render() {
                 sf::RectangleShape centerRect(sf::Vector2f(thickness, cyB - cyT));
                 centerRect.setPosition(x - thickness * 0.5f + 8.f, cyT);
                 centerRect.setFillColor(colOpaque);
-                window.draw(centerRect);
+                RenderStats::draw(window, centerRect);
             }
             // bottom fade
             if (edgeFade >= 1.f) {
@@ -1437,7 +1490,7 @@ void Game::render() {
                 botGrad[3] = sf::Vertex(sf::Vector2f(x - thickness*0.5f + 8.f, cyB), colOpaque);
                 botGrad[4] = sf::Vertex(sf::Vector2f(x + thickness*0.5f + 8.f, yB), colTransparent);
                 botGrad[5] = sf::Vertex(sf::Vector2f(x - thickness*0.5f + 8.f, yB), colTransparent);
-                window.draw(botGrad);
+                RenderStats::draw(window, botGrad);
             }
         };
 
@@ -1460,7 +1513,7 @@ void Game::render() {
             bar.setFillColor(sf::Color(36,36,36,220));
             bar.setOutlineColor(sf::Color(100,100,100,200));
             bar.setOutlineThickness(1.f);
-            window.draw(bar);
+            RenderStats::draw(window, bar);
 
             // icon slot placeholder on left (draw icon if available)
             float slotH = barHeight - 12.f;
@@ -1469,19 +1522,19 @@ void Game::render() {
             iconSlot.setFillColor(sf::Color(24,24,24,200));
             iconSlot.setOutlineThickness(1.f);
             iconSlot.setOutlineColor(sf::Color(80,80,80,200));
-            if (i < pauseIconSprites.size() && pauseIconTextures[i].getSize().x > 0) {
+            if (i < pauseIconSprites.size() && pauseIconRegions[i].valid()) {
                 sf::Sprite s = pauseIconSprites[i];
-                sf::Vector2u tsize = pauseIconTextures[i].getSize();
+                sf::Vector2u tsize = pauseIconRegions[i].getSize();
                 float scale = std::min(slotH / static_cast<float>(tsize.y), iconSlotW / static_cast<float>(tsize.x));
                 s.setScale(scale, scale);
                 float spriteW = tsize.x * scale;
                 float spriteX = leftColX + 8.f + (iconSlotW - spriteW) * 0.5f;
                 float spriteY = y + 6.f + (slotH - tsize.y * scale) * 0.5f;
                 s.setPosition(spriteX, spriteY);
-                window.draw(s);
+                RenderStats::draw(window, s);
             }
             else {
-                window.draw(iconSlot);
+                RenderStats::draw(window, iconSlot);
             }
             // label (right-aligned within bar, leaving padding)
             label.setString(leftLabels[i]);
@@ -1490,7 +1543,7 @@ void Game::render() {
             float textX = leftColX + colWidth - textRightPadding - lb.width - lb.left;
             float textY = y + (barHeight - lb.height) / 2.f - lb.top;
             label.setPosition(textX, textY);
-            window.draw(label);
+            RenderStats::draw(window, label);
         }
 
         for (size_t i = 0; i < rightLabels.size(); ++i) {
@@ -1501,7 +1554,7 @@ void Game::render() {
             bar.setFillColor(sf::Color(36,36,36,220));
             bar.setOutlineColor(sf::Color(100,100,100,200));
             bar.setOutlineThickness(1.f);
-            window.draw(bar);
+            RenderStats::draw(window, bar);
 
 
             // icon slot placeholder on left of this bar (draw icon if available)
@@ -1512,18 +1565,18 @@ void Game::render() {
             iconSlotR.setOutlineThickness(1.f);
             iconSlotR.setOutlineColor(sf::Color(80,80,80,200));
             size_t iconIndexR = leftLabels.size() + i;
-            if (iconIndexR < pauseIconSprites.size() && pauseIconTextures[iconIndexR].getSize().x > 0) {
+            if (iconIndexR < pauseIconSprites.size() && pauseIconRegions[iconIndexR].valid()) {
                 sf::Sprite s = pauseIconSprites[iconIndexR];
-                sf::Vector2u tsize = pauseIconTextures[iconIndexR].getSize();
+                sf::Vector2u tsize = pauseIconRegions[iconIndexR].getSize();
                 float scale = std::min(slotH_R / static_cast<float>(tsize.y), iconSlotW / static_cast<float>(tsize.x));
                 s.setScale(scale, scale);
                 float spriteW = tsize.x * scale;
                 float spriteX = rightColX + 8.f + (iconSlotW - spriteW) * 0.5f;
                 float spriteY = y + 6.f + (slotH_R - tsize.y * scale) * 0.5f;
                 s.setPosition(spriteX, spriteY);
-                window.draw(s);
+                RenderStats::draw(window, s);
             } else {
-                window.draw(iconSlotR);
+                RenderStats::draw(window, iconSlotR);
             }
 
             // label (right-aligned within bar)
@@ -1533,7 +1586,7 @@ void Game::render() {
             float textX = rightColX + colWidth - textRightPadding - lb.width - lb.left;
             float textY = y + (barHeight - lb.height) / 2.f - lb.top;
             label.setPosition(textX, y + (barHeight - lb.height) / 2.f - lb.top);
-            window.draw(label);
+            RenderStats::draw(window, label);
         }
 
         // Back button at bottom-right inside panel
@@ -1563,7 +1616,7 @@ void Game::render() {
                 sf::RectangleShape centerRect(sf::Vector2f(centerR - centerL, lineThickness));
                 centerRect.setPosition(centerL, lineY);
                 centerRect.setFillColor(colOpaque);
-                window.draw(centerRect);
+                RenderStats::draw(window, centerRect);
             }
             // left fade
             if (centerL > lx_full + 1.f) {
@@ -1574,7 +1627,7 @@ void Game::render() {
                 leftGrad[3] = sf::Vertex(sf::Vector2f(lx_full, lineY), colTransparentLocal);
                 leftGrad[4] = sf::Vertex(sf::Vector2f(centerL, lineY + lineThickness), colOpaque);
                 leftGrad[5] = sf::Vertex(sf::Vector2f(lx_full, lineY + lineThickness), colTransparentLocal);
-                window.draw(leftGrad);
+                RenderStats::draw(window, leftGrad);
             }
             // right fade
             if (centerR < rx_full - 1.f) {
@@ -1585,7 +1638,7 @@ void Game::render() {
                 rightGrad[3] = sf::Vertex(sf::Vector2f(centerR, lineY), colOpaque);
                 rightGrad[4] = sf::Vertex(sf::Vector2f(rx_full, lineY + lineThickness), colTransparentLocal);
                 rightGrad[5] = sf::Vertex(sf::Vector2f(centerR, lineY + lineThickness), colOpaque);
-                window.draw(rightGrad);
+                RenderStats::draw(window, rightGrad);
             }
         }
 
@@ -1605,7 +1658,7 @@ void Game::render() {
         backBorder.setOutlineThickness(2.f);
         backBorder.setOrigin(0.f, 0.f);
         backBorder.setPosition(backPos);
-        window.draw(backBorder);
+        RenderStats::draw(window, backBorder);
 
         // Icon slot (left side of back button)
         float slotW = ICON_W;
@@ -1615,18 +1668,18 @@ void Game::render() {
         iconSlot.setFillColor(sf::Color(24,24,24,200));
         iconSlot.setOutlineThickness(1.f);
         iconSlot.setOutlineColor(sf::Color(80,80,80,200));
-        if (backIconTexture.getSize().x > 0) {
-            sf::Vector2u bts = backIconTexture.getSize();
+        if (backIconRegion.valid()) {
+            sf::Vector2u bts = backIconRegion.getSize();
             float scale = std::min(slotH / static_cast<float>(bts.y), slotW / static_cast<float>(bts.x));
             backIconSprite.setScale(scale, scale);
             float spriteW = bts.x * scale;
             float spriteX = backPos.x + 8.f + (slotW - spriteW) * 0.5f;
             float spriteY = backPos.y + 6.f + (slotH - bts.y * scale) * 0.5f;
             backIconSprite.setPosition(spriteX, spriteY);
-            if (backHovered) { sf::Color prevCol = backIconSprite.getColor(); backIconSprite.setColor(sf::Color(255,255,180)); window.draw(backIconSprite); backIconSprite.setColor(prevCol); }
-            else window.draw(backIconSprite);
+            if (backHovered) { sf::Color prevCol = backIconSprite.getColor(); backIconSprite.setColor(sf::Color(255,255,180)); RenderStats::draw(window, backIconSprite); backIconSprite.setColor(prevCol); }
+            else RenderStats::draw(window, backIconSprite);
         } else {
-            window.draw(iconSlot);
+            RenderStats::draw(window, iconSlot);
         }
 
         sf::Text backText; backText.setFont(font); backText.setCharacterSize(BACK_CHAR_SIZE); backText.setString("Back"); backText.setFillColor(backHovered ? sf::Color::Yellow : sf::Color::White);
@@ -1634,7 +1687,7 @@ void Game::render() {
         float tx = backPos.x + 8.f + ICON_W + ICON_PAD;
         float ty = backPos.y + (backHeight - tb.height) / 2.f - tb.top;
         backText.setPosition(tx, ty);
-        window.draw(backText);
+        RenderStats::draw(window, backText);
     }
 
     // If paused and showingSettings, draw the settings panel (matches controls layout style)
@@ -1651,7 +1704,7 @@ void Game::render() {
         const float PANEL_EXTRA_OFFSET = 80.f;
         float panelCenterY = titleBottom + gap + PANEL_EXTRA_OFFSET + panel.getSize().y / 2.f;
         panel.setPosition(window.getSize().x / 2.f, panelCenterY);
-        window.draw(panel);
+        RenderStats::draw(window, panel);
 
         sf::Text title;
         title.setFont(font); title.setCharacterSize(52); title.setFillColor(sf::Color::White);
@@ -1659,7 +1712,7 @@ void Game::render() {
         sf::FloatRect tbb = title.getLocalBounds();
         title.setOrigin(tbb.left + tbb.width / 2.f, tbb.top + tbb.height / 2.f);
         title.setPosition(panel.getPosition().x, panel.getPosition().y - panel.getSize().y / 2.f + 40.f);
-        window.draw(title);
+        RenderStats::draw(window, title);
 
         // compute layout for sliders
         float sliderWidth = panelSize.x * 0.55f;
@@ -1684,7 +1737,7 @@ void Game::render() {
                 sf::RectangleShape centerRect(sf::Vector2f(centerRight - centerLeft, sepThickness));
                 centerRect.setPosition(centerLeft, sepY);
                 centerRect.setFillColor(colOpaque);
-                window.draw(centerRect);
+                RenderStats::draw(window, centerRect);
             }
             if (centerLeft > xL + 1.f) {
                 sf::VertexArray leftGrad(sf::Triangles, 6);
@@ -1694,7 +1747,7 @@ void Game::render() {
                 leftGrad[3] = sf::Vertex(sf::Vector2f(xL, sepY), colTransparent);
                 leftGrad[4] = sf::Vertex(sf::Vector2f(centerLeft, sepY + sepThickness), colOpaque);
                 leftGrad[5] = sf::Vertex(sf::Vector2f(xL, sepY + sepThickness), colTransparent);
-                window.draw(leftGrad);
+                RenderStats::draw(window, leftGrad);
             }
             if (centerRight < xR - 1.f) {
                 sf::VertexArray rightGrad(sf::Triangles, 6);
@@ -1704,7 +1757,7 @@ void Game::render() {
                 rightGrad[3] = sf::Vertex(sf::Vector2f(centerRight, sepY), colOpaque);
                 rightGrad[4] = sf::Vertex(sf::Vector2f(xR, sepY + sepThickness), colTransparent);
                 rightGrad[5] = sf::Vertex(sf::Vector2f(centerRight, sepY + sepThickness), colOpaque);
-                window.draw(rightGrad);
+                RenderStats::draw(window, rightGrad);
             }
         }
 
@@ -1717,7 +1770,7 @@ void Game::render() {
             bg.setFillColor(sf::Color(60, 60, 60, 220));
             bg.setOutlineColor(sf::Color(120, 120, 120, 200));
             bg.setOutlineThickness(1.f);
-            window.draw(bg);
+            RenderStats::draw(window, bg);
 
             // filled portion
             float fillW = sliderWidth * std::clamp(valuePct, 0.f, 1.f);
@@ -1725,7 +1778,7 @@ void Game::render() {
                 sf::RectangleShape fill(sf::Vector2f(fillW, barH));
                 fill.setPosition(sliderX, y - barH / 2.f);
                 fill.setFillColor(sf::Color(200, 200, 200, 220));
-                window.draw(fill);
+                RenderStats::draw(window, fill);
             }
 
             // thumb
@@ -1737,13 +1790,13 @@ void Game::render() {
             thumb.setFillColor(sf::Color::White);
             thumb.setOutlineColor(sf::Color(40, 40, 40));
             thumb.setOutlineThickness(1.f);
-            window.draw(thumb);
+            RenderStats::draw(window, thumb);
 
             // label on left of slider
             sf::Text lbl; lbl.setFont(font2); lbl.setCharacterSize(20); lbl.setFillColor(sf::Color::White); lbl.setString(labelStr);
             sf::FloatRect lb = lbl.getLocalBounds();
             lbl.setPosition(sliderX - lb.width - 16.f, y - lb.height / 2.f - lb.top);
-            window.draw(lbl);
+            RenderStats::draw(window, lbl);
 
             // numeric percent on right of slider
             sf::Text pct; pct.setFont(font2); pct.setCharacterSize(18); pct.setFillColor(sf::Color::White);
@@ -1751,7 +1804,7 @@ void Game::render() {
             pct.setString(std::to_string(iv) + "%");
             sf::FloatRect pb = pct.getLocalBounds();
             pct.setPosition(sliderX + sliderWidth + 16.f, y - pb.height / 2.f - pb.top);
-            window.draw(pct);
+            RenderStats::draw(window, pct);
             };
 
         // Rows: Master, Music, SFX
@@ -1769,7 +1822,7 @@ void Game::render() {
             box.setFillColor(sf::Color(30, 30, 30, 200));
             box.setOutlineThickness(1.f);
             box.setOutlineColor(sf::Color(120, 120, 120));
-            window.draw(box);
+            RenderStats::draw(window, box);
             if (muted) {
                 // draw an X
                 sf::VertexArray vx(sf::Lines, 4);
@@ -1778,7 +1831,7 @@ void Game::render() {
                 vx[1] = sf::Vertex(sf::Vector2f(x + muteW - 4.f, y + 4.f), col);
                 vx[2] = sf::Vertex(sf::Vector2f(x + 4.f, y + 4.f), col);
                 vx[3] = sf::Vertex(sf::Vector2f(x + muteW - 4.f, y - 4.f), col);
-                window.draw(vx);
+                RenderStats::draw(window, vx);
             }
             };
 
@@ -1812,7 +1865,7 @@ void Game::render() {
                 sf::RectangleShape centerRect(sf::Vector2f(centerR - centerL, lineThickness));
                 centerRect.setPosition(centerL, lineY);
                 centerRect.setFillColor(colOpaque);
-                window.draw(centerRect);
+                RenderStats::draw(window, centerRect);
             }
             if (centerL > lx_full + 1.f) {
                 sf::VertexArray leftGrad(sf::Triangles, 6);
@@ -1822,7 +1875,7 @@ void Game::render() {
                 leftGrad[3] = sf::Vertex(sf::Vector2f(lx_full, lineY), colTransparentLocal);
                 leftGrad[4] = sf::Vertex(sf::Vector2f(centerL, lineY + lineThickness), colOpaque);
                 leftGrad[5] = sf::Vertex(sf::Vector2f(lx_full, lineY + lineThickness), colTransparentLocal);
-                window.draw(leftGrad);
+                RenderStats::draw(window, leftGrad);
             }
             if (centerR < rx_full - 1.f) {
                 sf::VertexArray rightGrad(sf::Triangles, 6);
@@ -1832,7 +1885,7 @@ void Game::render() {
                 rightGrad[3] = sf::Vertex(sf::Vector2f(centerR, lineY), colOpaque);
                 rightGrad[4] = sf::Vertex(sf::Vector2f(rx_full, lineY + lineThickness), colTransparentLocal);
                 rightGrad[5] = sf::Vertex(sf::Vector2f(centerR, lineY + lineThickness), colOpaque);
-                window.draw(rightGrad);
+                RenderStats::draw(window, rightGrad);
             }
         }
 
@@ -1850,7 +1903,7 @@ void Game::render() {
         backBorder2.setOutlineThickness(2.f);
         backBorder2.setOrigin(0.f, 0.f);
         backBorder2.setPosition(backPos2);
-        window.draw(backBorder2);
+        RenderStats::draw(window, backBorder2);
 
         // icon slot
         float slotW2 = ICON_W;
@@ -1860,19 +1913,19 @@ void Game::render() {
         iconSlot2.setFillColor(sf::Color(24, 24, 24, 200));
         iconSlot2.setOutlineThickness(1.f);
         iconSlot2.setOutlineColor(sf::Color(80, 80, 80, 200));
-        if (backIconTexture.getSize().x > 0) {
-            sf::Vector2u bts = backIconTexture.getSize();
+        if (backIconRegion.valid()) {
+            sf::Vector2u bts = backIconRegion.getSize();
             float scale = std::min(slotH2 / static_cast<float>(bts.y), slotW2 / static_cast<float>(bts.x));
             backIconSprite.setScale(scale, scale);
             float spriteW = bts.x * scale;
             float spriteX = backPos2.x + 8.f + (slotW2 - spriteW) * 0.5f;
             float spriteY = backPos2.y + 6.f + (slotH2 - bts.y * scale) * 0.5f;
             backIconSprite.setPosition(spriteX, spriteY);
-            if (backHovered2) { sf::Color prevCol = backIconSprite.getColor(); backIconSprite.setColor(sf::Color(255, 255, 180)); window.draw(backIconSprite); backIconSprite.setColor(prevCol); }
-            else window.draw(backIconSprite);
+            if (backHovered2) { sf::Color prevCol = backIconSprite.getColor(); backIconSprite.setColor(sf::Color(255, 255, 180)); RenderStats::draw(window, backIconSprite); backIconSprite.setColor(prevCol); }
+            else RenderStats::draw(window, backIconSprite);
         }
         else {
-            window.draw(iconSlot2);
+            RenderStats::draw(window, iconSlot2);
         }
 
         sf::Text backText2; backText2.setFont(font); backText2.setCharacterSize(BACK_CHAR_SIZE); backText2.setString("Back"); backText2.setFillColor(backHovered2 ? sf::Color::Yellow : sf::Color::White);
@@ -1880,7 +1933,7 @@ void Game::render() {
         float tx2 = backPos2.x + 8.f + ICON_W + ICON_PAD;
         float ty2 = backPos2.y + (backHeight2 - tb2.height) / 2.f - tb2.top;
         backText2.setPosition(tx2, ty2);
-        window.draw(backText2);
+        RenderStats::draw(window, backText2);
     }
 
     // Draw GAME OVER text when triggered (fades in)
@@ -1900,7 +1953,7 @@ void Game::render() {
         sf::FloatRect gb = goText.getLocalBounds();
         goText.setOrigin(gb.left + gb.width / 2.f, gb.top + gb.height / 2.f);
         goText.setPosition(static_cast<float>(window.getSize().x) * 0.5f, static_cast<float>(window.getSize().y) * 0.30f);
-        window.draw(goText);
+        RenderStats::draw(window, goText);
 
         // Compute the title world rect (accounts for origin used above)
         sf::FloatRect titleWorldRect(
@@ -1923,13 +1976,13 @@ void Game::render() {
         sf::RectangleShape ulBack(ulSize + sf::Vector2f(6.f, 3.f));
         ulBack.setPosition(ulPos - sf::Vector2f(3.f, 1.5f));
         ulBack.setFillColor(sf::Color(0, 0, 0, ia));
-        window.draw(ulBack);
+        RenderStats::draw(window, ulBack);
 
         // Foreground underline (white or hover-accent if you want)
         sf::RectangleShape underline(ulSize);
         underline.setPosition(ulPos);
         underline.setFillColor(sf::Color(255, 255, 255, ia));
-        window.draw(underline);
+        RenderStats::draw(window, underline);
 
   
         // Draw two simple centered menu entries under the GAME OVER title
@@ -1993,7 +2046,7 @@ void Game::render() {
             it.setOutlineThickness(outlineThickness);
             it.setFillColor(static_cast<int>(i) == hoveredIndex ? fillHover : fillNormal);
 
-            window.draw(it);
+            RenderStats::draw(window, it);
         }
 
         // Update hover-tracking state used by hover-sound logic elsewhere
@@ -2006,22 +2059,82 @@ void Game::render() {
         }
     }
 
-    window.display();
+    if (showRenderStats) drawRenderStatsOverlay();
+    // Presented by run() so the frame's work can be timed without the limiter's sleep
+}
+
+void Game::drawRenderStatsOverlay() {
+    RenderStats::Scope statsScope(RenderStats::Subsystem::OTHER);
+    window.setView(window.getDefaultView());
+    // One multi-line text per column so the proportional font still lines up
+    const int kColumns = 6;
+    std::ostringstream cols[kColumns];
+    const char* headers[kColumns] = { "subsystem", "draws", "verts", "tex", "shd", "rt" };
+    for (int c = 0; c < kColumns; ++c) cols[c] << headers[c];
+    auto row = [&cols](const char* name, const RenderStats::Counters& rc) {
+        cols[0] << "\n" << name;
+        cols[1] << "\n" << rc.drawCalls;
+        cols[2] << "\n" << rc.vertices;
+        cols[3] << "\n" << rc.textureSwitches;
+        cols[4] << "\n" << rc.shaderSwitches;
+        cols[5] << "\n" << rc.targetSwitches;
+    };
+    for (int i = 0; i < static_cast<int>(RenderStats::Subsystem::COUNT); ++i) {
+        RenderStats::Subsystem s = static_cast<RenderStats::Subsystem>(i);
+        row(RenderStats::getName(s), RenderStats::getLastFrame(s));
+    }
+    row("total", RenderStats::getLastFrameTotal());
+
+    std::vector<sf::Text> texts;
+    float width = 0.f, height = 0.f;
+    const float gap = 14.f;
+    for (int c = 0; c < kColumns; ++c) {
+        texts.emplace_back(cols[c].str(), font2, 14);
+        sf::FloatRect tb = texts.back().getLocalBounds();
+        texts.back().setOrigin(tb.left, tb.top);
+        texts.back().setPosition(width, 0.f);
+        width += tb.width + (c + 1 < kColumns ? gap : 0.f);
+        height = std::max(height, tb.height);
+    }
+
+    const float pad = 8.f;
+    sf::Vector2f origin(static_cast<float>(window.getSize().x) - width - pad * 2.f - 10.f, 10.f);
+    sf::RectangleShape panel(sf::Vector2f(width + pad * 2.f, height + pad * 2.f));
+    panel.setPosition(origin);
+    panel.setFillColor(sf::Color(0, 0, 0, 170));
+    RenderStats::draw(window, panel);
+    for (sf::Text& t : texts) {
+        t.move(origin.x + pad, origin.y + pad);
+        t.setFillColor(sf::Color::White);
+        RenderStats::draw(window, t);
+    }
 }
 
-sf::Sprite& Game::getMapSprite(int level) {
+GroundMap& Game::getGroundMap(int level) {
     switch (level) {
         case 0:
         case 1:
         case 4:
         case 5:
-            return mapSprite1;
+            return groundMaps[0];
         case 2:
-            return mapSprite2;
+            return groundMaps[1];
         case 3:
-            return mapSprite3;
+            return groundMaps[2];
+        default:
+            return groundMaps[0];
+    }
+}
+
+// Ambient light per level in 2x-modulate space: 128 leaves the art untouched
+sf::Color Game::getAmbientLight(int level) {
+    switch (level) {
+        case 4:
+            return sf::Color(92, 92, 108);
+        case 5:
+            return sf::Color(64, 64, 84);
         default:
-            return mapSprite1;
+            return sf::Color(128, 128, 128);
     }
 }
 
@@ -6,6 +6,15 @@
 #include "Player.h"
 #include "LevelManager.h"
 #include "PhysicsWorld.h"
+#include "FrameScheduler.h"
+#include "WorldOverlay.h"
+#include "TextureAtlas.h"
+#include "FontService.h"
+#include "PostProcessChain.h"
+#include "GroundMap.h"
+#include "DynamicResolution.h"
+#include "FramePacer.h"
+#include "LightMap.h"
 #include <array>
 #include <vector>
 
@@ -20,8 +29,9 @@ public:
     int getPoints() const;
     void reset();
     
-    sf::Sprite& getMapSprite(int level);
+    GroundMap& getGroundMap(int level);
     sf::Vector2u getMapSize(int level); // Added to get map size dynamically
+    sf::Color getAmbientLight(int level);
 
     // Pause control
     bool isPaused() const { return paused; }
@@ -35,18 +45,15 @@ private:
     Player player;
     LevelManager levelManager;
     PhysicsWorld physics;
+    // Deferred work (zombie activation, pool growth, decal stamping) drained per frame within a budget
+    FrameScheduler scheduler;
     
-    sf::Sprite mapSprite1;
-    sf::Sprite mapSprite2;
-    sf::Sprite mapSprite3;
-    sf::Texture mapTexture1;
-    sf::Texture mapTexture2;
-    sf::Texture mapTexture3;
+    // Tiled ground per map (levels 0/1/4/5 share the first). Only the current map's
+    // tiles stay resident; switching maps releases the previous one.
+    GroundMap groundMaps[3];
+    GroundMap* activeGround = nullptr;
     sf::RectangleShape background;
     
-    // HUD tally textures for rounds (0..4)
-    std::array<sf::Texture,5> tallyTextures;
-
     int points;
     int zombiesToNextLevel;
     sf::Text pointsText;
@@ -67,6 +74,8 @@ private:
     void checkPlayerBoundaries();
     
     void drawHUD();
+    // F3 debug panel with last frame's render counters per subsystem
+    void drawRenderStatsOverlay();
 
     sf::Music cutsceneMusic;
     sf::Music backgroundMusic;
@@ -99,30 +108,33 @@ private:
     // For feet we support one texture per feet state (idle, walk, run, strafe left, strafe right)
     std::array<sf::Texture,5> playerFeetStateTextures;
 
+    // Pages holding the HUD/menu icons: weapon and key icons, tally marks, pause panel icons.
+    // Regions handed to LevelManager point into these pages, so the atlas must outlive it.
+    TextureAtlas hudAtlas;
+
     // Icons used in the pause controls panel (load from Scene assets to match menu)
-    std::vector<sf::Texture> pauseIconTextures;
+    std::vector<TextureRegion> pauseIconRegions;
     std::vector<sf::Sprite> pauseIconSprites;
 
     // Back button icon (escape icon used in scene)
-    sf::Texture backIconTexture;
+    TextureRegion backIconRegion;
     sf::Sprite backIconSprite;
 
-    // Weapon icon textures used by LevelManager HUD (must outlive LevelManager usage)
-    sf::Texture pistolIconTexture;
-    sf::Texture rifleIconTexture;
-    // Key icons for HUD equip buttons
-    sf::Texture keyIcon1Texture;
-    sf::Texture keyIcon2Texture;
-    sf::Texture KeyIconEscTexture;
     // Reload key icon used by on-screen reload prompt (optional)
-    sf::Texture reloadKeyTexture;
+    TextureRegion reloadKeyRegion;
     sf::Sprite reloadKeySprite;
-    // Optional Esc key icon used in tutorial dialog
-    sf::Texture escKeyTexture;
+    // Reload prompt labels, built once in the constructor and only repositioned per frame
+    sf::Text reloadPromptText;
+    sf::Text reloadKeyLetter;
+    // Health bars and prompt panels batched into at most two draws per frame
+    WorldOverlay worldOverlay;
+    // Aim cone, drawn from the render queue just beneath the player
+    WorldOverlay aimOverlay;
+    // Y-sorted zombies + player for the current frame
+    RenderQueue renderQueue;
 
     // Blood overlay texture shown as screen-space HUD when player is damaged
     sf::Texture bloodTexture;
-    sf::Sprite bloodSprite;
     // Maximum alpha when health is zero (0..255)
     float bloodMaxAlpha = 200.f;
     // Exponent controlling how quickly the blood intensifies as health falls (1.0 linear, 2.0 squared)
@@ -133,13 +145,23 @@ private:
     // Blood particle texture (used by Explosion for textured blood particles)
     sf::Texture bloodParticleTexture;
 
-    // Render-to-texture for world rendering so we can apply a desaturation shader
-    sf::RenderTexture worldRenderTexture;
-    sf::Sprite worldTextureSprite;
-    sf::Shader desaturateShader;
-    bool desaturateShaderLoaded = false;
+    // World post-processing (desaturation + blood overlay). Skipped entirely while both are neutral.
+    PostProcessChain postProcess;
+    // Quarter-resolution light buffer multiplied over the world (muzzle flashes, dark levels)
+    LightMap lightMap;
+    // Soft light carried by the player so dark levels stay readable
+    float playerLightRadius = 320.0f;
+    // Store blood stains at half resolution: a quarter of the decal VRAM, softer stains
+    bool halfResGroundDecals = false;
+    // World render scale chosen from recent frame times (HUD always stays native)
+    DynamicResolution dynamicResolution;
+    // Main loop frame limiter; drops to its idle rate while paused or unfocused
+    FramePacer framePacer;
+    bool useVerticalSync = false;
     // Exponent controlling desaturation curve: higher -> slower ramp for mid-health values
     float desaturatePow = 2.5f;
+    // Grey mix at zero health; kept well below 1 so the world never turns fully grey
+    float desaturateMaxStrength = 0.4f;
 
     // Muzzle flash texture (placeholder path will be used in Game.cpp)
     sf::Texture muzzleFlashTexture;
@@ -155,6 +177,7 @@ private:
     float renderAlpha = 1.0f;
     // Debug visuals
     bool debugDrawHitboxes = false;
+    bool showRenderStats = false;
     // Track whether player's physics body has been removed from the PhysicsWorld after death
     bool playerBodyRemoved = false;
     // Ensure we notify zombies once when player dies
@@ -0,0 +1,82 @@
+#include "GroundMap.h"
+#include "ViewCulling.h"
+#include "RenderStats.h"
+#include <algorithm>
+#include <cmath>
+
+bool GroundMap::loadRepeating(const std::string& texturePath, const sf::Vector2u& size) {
+    if (texturePath.empty() || size.x == 0 || size.y == 0) return false;
+    release();
+    path = texturePath;
+    worldSize = size;
+    if (!texture.loadFromFile(path)) return false;
+    texture.setRepeated(true);
+    textureReady = true;
+    buildGeometry();
+    return true;
+}
+
+void GroundMap::release() {
+    texture = sf::Texture();
+    textureReady = false;
+}
+
+void GroundMap::buildGeometry() {
+    // Texture coords are world pixels and run on across tiles, so the repeated texture
+    // wraps seamlessly whatever its size.
+    cols = static_cast<int>((worldSize.x + kTileSize - 1) / kTileSize);
+    rows = static_cast<int>((worldSize.y + kTileSize - 1) / kTileSize);
+
+    vertices.clear();
+    vertices.reserve(static_cast<std::size_t>(cols) * rows * 6);
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            float l = static_cast<float>(c * kTileSize);
+            float t = static_cast<float>(r * kTileSize);
+            float rr = std::min(l + kTileSize, static_cast<float>(worldSize.x));
+            float b = std::min(t + kTileSize, static_cast<float>(worldSize.y));
+            sf::Vertex tl(sf::Vector2f(l, t), sf::Vector2f(l, t));
+            sf::Vertex tr(sf::Vector2f(rr, t), sf::Vector2f(rr, t));
+            sf::Vertex br(sf::Vector2f(rr, b), sf::Vector2f(rr, b));
+            sf::Vertex bl(sf::Vector2f(l, b), sf::Vector2f(l, b));
+            vertices.push_back(tl); vertices.push_back(tr); vertices.push_back(br);
+            vertices.push_back(tl); vertices.push_back(br); vertices.push_back(bl);
+        }
+    }
+
+    useVertexBuffer = sf::VertexBuffer::isAvailable() && vertexBuffer.create(vertices.size()) && vertexBuffer.update(vertices.data());
+}
+
+void GroundMap::tileRange(const sf::FloatRect& rect, int& c0, int& r0, int& c1, int& r1) const {
+    const float tile = static_cast<float>(kTileSize);
+    c0 = std::max(0, static_cast<int>(std::floor(rect.left / tile)));
+    r0 = std::max(0, static_cast<int>(std::floor(rect.top / tile)));
+    c1 = std::min(cols - 1, static_cast<int>(std::floor((rect.left + rect.width) / tile)));
+    r1 = std::min(rows - 1, static_cast<int>(std::floor((rect.top + rect.height) / tile)));
+}
+
+void GroundMap::update() {
+    if (!isConfigured() || textureReady) return;
+    if (texture.loadFromFile(path)) {
+        texture.setRepeated(true);
+        textureReady = true;
+    } else {
+        // Bad file: forget it so we don't retry every frame
+        path.clear();
+    }
+}
+
+void GroundMap::draw(sf::RenderTarget& target) const {
+    RenderStats::Scope statsScope(RenderStats::Subsystem::MAP);
+    if (!textureReady || vertices.empty()) return;
+    int c0, r0, c1, r1;
+    tileRange(viewCullRect(target, 0.0f), c0, r0, c1, r1);
+    if (c0 > c1 || r0 > r1) return;
+
+    // Tiles are row-major, so first to last visible tile is one contiguous span. It may
+    // include a few off-screen tiles at the row ends, which costs less than a draw per row.
+    std::size_t first = (static_cast<std::size_t>(r0) * cols + c0) * 6;
+    std::size_t last = (static_cast<std::size_t>(r1) * cols + c1 + 1) * 6;
+    if (useVertexBuffer) RenderStats::draw(target, vertexBuffer, first, last - first, sf::RenderStates(&texture));
+    else RenderStats::draw(target, &vertices[first], last - first, sf::Triangles, sf::RenderStates(&texture));
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+
+// A level's ground: one small texture repeated across the map in fixed-size tiles. The
+// tile quads are built once into a static vertex buffer and the visible span is drawn in
+// a single call. Only the current level's ground texture is kept on the GPU.
+class GroundMap {
+public:
+    static const unsigned int kTileSize = 512;
+
+    // Small texture repeated across the map, one tile per kTileSize texels
+    bool loadRepeating(const std::string& path, const sf::Vector2u& worldSize);
+
+    // Drop the texture. Geometry and path are kept, so the next update() loads it back.
+    void release();
+
+    // Reload the texture after a release()
+    void update();
+    // Draw the tiles overlapping the target's current view
+    void draw(sf::RenderTarget& target) const;
+
+    bool isConfigured() const { return !path.empty(); }
+    int getTileCount() const { return cols * rows; }
+    // Ground textures currently on the GPU
+    int getResidentTextureCount() const { return textureReady ? 1 : 0; }
+
+private:
+    void buildGeometry();
+    void tileRange(const sf::FloatRect& rect, int& c0, int& r0, int& c1, int& r1) const;
+
+    std::string path;
+    sf::Vector2u worldSize{ 0, 0 };
+    int cols = 0;
+    int rows = 0;
+
+    // Static tile quads (6 vertices per tile, row-major). The vertex copy is used when
+    // vertex buffers are unavailable.
+    sf::VertexBuffer vertexBuffer{ sf::Triangles, sf::VertexBuffer::Static };
+    std::vector<sf::Vertex> vertices;
+    bool useVertexBuffer = false;
+
+    sf::Texture texture;
+    bool textureReady = false;
+};
@@ -1,66 +1,78 @@
 #include "Guts.hpp" // adjust path if you placed header elsewhere
-#include <random>
+#include "RenderStats.h"
+#include <cstdint>
 #include <cmath>
+#include <algorithm>
 
 sf::Texture Guts::_texture;
+sf::Sprite Guts::_sprite;
+sf::CircleShape Guts::_piece;
+std::vector<Guts> Guts::_pool;
+std::vector<Guts*> Guts::_free;
 std::vector<Guts*> Guts::_active;
+CullStats Guts::_cullStats;
+
+namespace {
+    // xorshift32 shared by every spawn; replaces a per-instance mt19937
+    uint32_t gRngState = 0x9E3779B9U;
+
+    float randomRange(float lo, float hi) {
+        gRngState ^= gRngState << 13;
+        gRngState ^= gRngState >> 17;
+        gRngState ^= gRngState << 5;
+        return lo + (hi - lo) * static_cast<float>(gRngState >> 8) * (1.0f / 16777216.0f);
+    }
+}
 
 Guts::Guts()
-    : Entity(EntityType::Bullet, Vec2(0,0), Vec2(8.f,8.f), false, 0.01f, true),
-      _initialVelocity(0,0), _isDone(true), _duration(0.0f)
+    : _initialVelocity(0,0), _isDone(true), _duration(0.0f)
 {
 }
 
-Guts::Guts(const Vec2& pos, const Vec2& v)
-    : Entity(EntityType::Bullet, pos, Vec2(6.f,6.f), false, 0.01f, true),
-      _initialVelocity(v), _isDone(false), _duration(20.0f)
-{
-    body.isCircle = true;
-    body.getCircleShape().setRadius(3.f);
-    body.getCircleShape().setOrigin(3.f, 3.f);
-    body.position = pos;
+void Guts::spawn(const Vec2& pos, const Vec2& v) {
+    _initialVelocity = v;
+    _isDone = false;
+    _duration = 20.0f;
 
     // create simple particle cloud
-    std::mt19937 rng(static_cast<unsigned int>(std::rand()));
-    std::uniform_real_distribution<float> angDist(0.0f, 2.0f * 3.14159265f);
-    std::uniform_real_distribution<float> speedDist(10.0f, 80.0f);
-    int count = 12;
-    _particlesPos.reserve(count);
-    _particlesVel.reserve(count);
-    for (int i = 0; i < count; ++i) {
-        float a = angDist(rng);
-        float s = speedDist(rng);
+    for (int i = 0; i < kPieces; ++i) {
+        float a = randomRange(0.0f, 2.0f * 3.14159265f);
+        float s = randomRange(10.0f, 80.0f);
         Vec2 vel(std::cos(a) * s + _initialVelocity.x, std::sin(a) * s + _initialVelocity.y);
-        _particlesPos.emplace_back(pos.x + std::cos(a) * 2.0f, pos.y + std::sin(a) * 2.0f);
-        _particlesVel.emplace_back(vel.x * 0.01f, vel.y * 0.01f);
+        _particlesPos[i] = Vec2(pos.x + std::cos(a) * 2.0f, pos.y + std::sin(a) * 2.0f);
+        _particlesVel[i] = Vec2(vel.x * 0.01f, vel.y * 0.01f);
     }
+}
 
-    if (_texture.getSize().x > 0) {
-        _sprite.setTexture(_texture);
-        _sprite.setOrigin(_texture.getSize().x/2.f, _texture.getSize().y/2.f);
-        _sprite.setScale(0.05f, 0.05f);
-    }
+void Guts::initPool() {
+    if (!_pool.empty()) return;
+    _pool.resize(kPoolCapacity);
+    _free.reserve(kPoolCapacity);
+    _active.reserve(kPoolCapacity);
+    for (size_t i = kPoolCapacity; i--;) _free.push_back(&_pool[i]);
 }
 
 void Guts::init() {
+    initPool();
     if (Guts::_texture.getSize().x == 0) {
         // try load optional texture - support both proposed locations
         if (!Guts::_texture.loadFromFile("TDCod/Assets/Props/guts.png")) {
             Guts::_texture.loadFromFile("TDCod/Assets/guts.png");
         }
     }
+    setTexture(Guts::_texture);
 }
 
 void Guts::setTexture(const sf::Texture& tex) {
-    Guts::_texture = tex;
+    if (&tex != &Guts::_texture) Guts::_texture = tex;
     if (Guts::_texture.getSize().x > 0) {
-        for (auto g : Guts::_active) {
-            g->_sprite.setTexture(Guts::_texture);
-            g->_sprite.setOrigin(Guts::_texture.getSize().x / 2.f,
-                Guts::_texture.getSize().y / 2.f);
-            g->_sprite.setScale(0.05f, 0.05f);
-        }
+        _sprite.setTexture(Guts::_texture, true);
+        _sprite.setOrigin(Guts::_texture.getSize().x / 2.f,
+            Guts::_texture.getSize().y / 2.f);
+        _sprite.setScale(0.05f, 0.05f);
     }
+    _piece.setRadius(3.0f);
+    _piece.setOrigin(3.0f, 3.0f);
 }
 
 void Guts::update(float dt) {
@@ -71,56 +83,74 @@ void Guts::update(float dt) {
     }
 
     // simple particle motion with tiny gravity
-    for (size_t i = 0; i < _particlesPos.size(); ++i) {
+    for (int i = 0; i < kPieces; ++i) {
         _particlesVel[i].y += 9.8f * dt * 0.05f;
         _particlesPos[i] += _particlesVel[i] * dt * 60.0f; // scale to match world units
     }
-
-    if (!_particlesPos.empty()) {
-        body.position = _particlesPos[0];
-        body.update(dt);
-    }
 }
 
-void Guts::render(sf::RenderWindow& window) {
-    for (size_t i = 0; i < _particlesPos.size(); ++i) {
+void Guts::render(sf::RenderTarget& window) {
+    for (int i = 0; i < kPieces; ++i) {
         if (_texture.getSize().x > 0) {
             _sprite.setPosition(_particlesPos[i].x, _particlesPos[i].y);
             _sprite.setRotation((float)(std::fmod(i * 37.0, 360.0)));
-            window.draw(_sprite);
+            RenderStats::draw(window, _sprite);
         } else {
-            sf::CircleShape c(3.0f);
-            c.setOrigin(3.0f, 3.0f);
-            c.setPosition(_particlesPos[i].x, _particlesPos[i].y);
-            c.setFillColor(!_isDone ? sf::Color::Red : sf::Color(120, 40, 40));
-            window.draw(c);
+            _piece.setPosition(_particlesPos[i].x, _particlesPos[i].y);
+            _piece.setFillColor(!_isDone ? sf::Color::Red : sf::Color(120, 40, 40));
+            RenderStats::draw(window, _piece);
         }
     }
 }
 
 void Guts::kill() {
     _isDone = true;
-    _particlesPos.clear();
-    _particlesVel.clear();
-    destroy(); // Entity::destroy() to mark it dead
 }
 
 // Static management
 void Guts::add(const Vec2& pos, const Vec2& vel) {
-    Guts* g = new Guts(pos, vel);
+    initPool();
+    if (_free.empty()) return;
+    Guts* g = _free.back();
+    _free.pop_back();
+    g->spawn(pos, vel);
     _active.push_back(g);
 }
 
 void Guts::updateAll(float dt) {
-    for (int i = (int)_active.size() - 1; i >= 0; --i) {
-        _active[i]->update(dt);
-        if (_active[i]->_isDone) {
-            delete _active[i];
-            _active.erase(_active.begin() + i);
+    for (size_t i = 0; i < _active.size(); ) {
+        Guts* g = _active[i];
+        g->update(dt);
+        if (g->_isDone) {
+            // swap-remove: order doesn't matter for gore
+            _active[i] = _active.back();
+            _active.pop_back();
+            _free.push_back(g);
+        } else {
+            ++i;
         }
     }
 }
 
-void Guts::renderAll(sf::RenderWindow& window) {
-    for (auto g : _active) g->render(window);
-}
\ No newline at end of file
+void Guts::renderAll(sf::RenderTarget& window) {
+    RenderStats::Scope statsScope(RenderStats::Subsystem::PARTICLES);
+    sf::FloatRect view = viewCullRect(window, 0.0f);
+    _cullStats.reset();
+    for (auto g : _active) {
+        if (!view.intersects(g->getBounds())) { ++_cullStats.culled; continue; }
+        ++_cullStats.drawn;
+        g->render(window);
+    }
+}
+
+sf::FloatRect Guts::getBounds() const {
+    float minX = _particlesPos[0].x, maxX = minX;
+    float minY = _particlesPos[0].y, maxY = minY;
+    for (const Vec2& p : _particlesPos) {
+        minX = std::min(minX, p.x); maxX = std::max(maxX, p.x);
+        minY = std::min(minY, p.y); maxY = std::max(maxY, p.y);
+    }
+    // pad by the largest sprite half-extent so pieces straddling the edge still draw
+    const float pad = 32.0f;
+    return sf::FloatRect(minX - pad, minY - pad, maxX - minX + pad * 2.0f, maxY - minY + pad * 2.0f);
+}
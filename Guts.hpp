@@ -1,43 +1,65 @@
 #pragma once
 
-#include "Entity.h"
 #include "Vec2.h"
+#include "ViewCulling.h"
 #include <SFML/Graphics.hpp>
 #include <vector>
+#include <array>
 
-class Guts : public Entity {
+// Small cloud of gore pieces thrown from a kill. Instances are plain records living in a
+// fixed pool: spawning takes a free slot, finished ones are swap-removed from the active
+// list and their slot returned, so steady gore never touches the heap.
+class Guts {
 public:
     Guts();
-    Guts(const Vec2& pos, const Vec2& v);
 
     bool isDone() const { return _isDone; }
 
     // Project-style API: update and render accept simple parameters
     void update(float dt);
-    void render(sf::RenderWindow& window);
+    void render(sf::RenderTarget& window);
     void kill();
 
     static void init();
 
     // Static management
+    // Dropped silently when every pool slot is in use (gore is purely cosmetic)
     static void add(const Vec2& pos, const Vec2& vel);
     static void updateAll(float dt);
-    static void renderAll(sf::RenderWindow& window);
+    static void renderAll(sf::RenderTarget& window);
+    // Guts drawn vs. skipped by view culling in the last renderAll
+    static const CullStats& getCullStats() { return _cullStats; }
+    static size_t getActiveCount() { return _active.size(); }
 
     // Allow external code to provide a texture loaded by Game
     static void setTexture(const sf::Texture& tex);
 
 private:
+    static const int kPieces = 12;
+    static const size_t kPoolCapacity = 256;
+
+    void spawn(const Vec2& pos, const Vec2& v);
+
     Vec2 _initialVelocity;
     bool _isDone;
     float _duration;
 
     // simple particles for visual effect
-    std::vector<Vec2> _particlesPos;
-    std::vector<Vec2> _particlesVel;
+    std::array<Vec2, kPieces> _particlesPos;
+    std::array<Vec2, kPieces> _particlesVel;
 
     static sf::Texture _texture; // optional; if not loaded we render simple shapes
-    sf::Sprite _sprite;
+    // Shared by every instance when rendering (sprite if textured, circle otherwise)
+    static sf::Sprite _sprite;
+    static sf::CircleShape _piece;
 
+    static std::vector<Guts> _pool;
+    static std::vector<Guts*> _free;
     static std::vector<Guts*> _active;
-};
\ No newline at end of file
+    static CullStats _cullStats;
+
+    static void initPool();
+
+    // World bounds of the particle cloud, used for view culling
+    sf::FloatRect getBounds() const;
+};
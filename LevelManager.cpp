@@ -1,10 +1,12 @@
 #include "LevelManager.h"
 #include "PhysicsWorld.h"
+#include "RenderStats.h"
+#include "Explosion.hpp"
 #
  // Implement setters declared in header
-void LevelManager::setKeyIcon1(const sf::Texture& tex) { keyIcon1 = &tex; }
-void LevelManager::setKeyIcon2(const sf::Texture& tex) { keyIcon2 = &tex; }
-void LevelManager::setKeyIconEsc(const sf::Texture& tex) { keyIconEsc = &tex; }
+void LevelManager::setKeyIcon1(const TextureRegion& region) { keyIcon1 = region; invalidateHud(); }
+void LevelManager::setKeyIcon2(const TextureRegion& region) { keyIcon2 = region; invalidateHud(); }
+void LevelManager::setKeyIconEsc(const TextureRegion& region) { keyIconEsc = region; }
 
 #include <memory>
 #include <iostream>
@@ -23,92 +25,6 @@ static float easeInOutCubic(float t) {
     return 1.0f - (f * f * f) / 2.0f;
 }
 
-// Helper: wrap text to fit within a given width for an sf::Text prototype
-static std::string wrapText(const sf::Text& prototype, const std::string& input, float maxWidth, int maxLines = -1) {
-    // Preserve existing paragraph breaks
-    std::istringstream paragraphStream(input);
-    std::string paragraph;
-    std::string result;
-    bool firstParagraph = true;
-    int lineCount = 0;
-
-    while (std::getline(paragraphStream, paragraph)) {
-        if (!firstParagraph) {
-            // if adding a blank line would exceed maxLines, stop
-            if (maxLines >= 0 && lineCount + 1 > maxLines) {
-                result += "...";
-                return result;
-            }
-            result += '\n';
-            lineCount += 1;
-        }
-        firstParagraph = false;
-
-        std::istringstream wordStream(paragraph);
-        std::string word;
-        std::string line;
-
-        while (wordStream >> word) {
-            std::string candidate = line.empty() ? word : (line + " " + word);
-            sf::Text meas = prototype;
-            meas.setString(candidate);
-            // getLocalBounds().width gives width without transform
-            if (meas.getLocalBounds().width <= maxWidth) {
-                line = candidate;
-            } else {
-                if (!line.empty()) {
-                    // current line is full, flush it and start new line with the word
-                    if (maxLines >= 0 && lineCount + 1 > maxLines) {
-                        // no space for this line -> append ellipsis to previous and return
-                        // Trim trailing whitespace
-                        while (!result.empty() && (result.back() == '\n' || result.back() == ' ')) result.pop_back();
-                        result += "...";
-                        return result;
-                    }
-                    result += line + '\n';
-                    lineCount += 1;
-                    line = word;
-                } else {
-                    // single word longer than maxWidth: break the word by characters
-                    std::string part;
-                    for (char c : word) {
-                        std::string test = part + c;
-                        meas.setString(test);
-                        if (meas.getLocalBounds().width <= maxWidth) {
-                            part = test;
-                        } else {
-                            if (!part.empty()) {
-                                if (maxLines >= 0 && lineCount + 1 > maxLines) {
-                                    // append ellipsis and return
-                                    while (!result.empty() && (result.back() == '\n' || result.back() == ' ')) result.pop_back();
-                                    result += "...";
-                                    return result;
-                                }
-                                result += part + '\n';
-                                lineCount += 1;
-                            }
-                            part = std::string(1, c);
-                        }
-                    }
-                    line = part;
-                }
-            }
-        }
-
-        if (!line.empty()) {
-            if (maxLines >= 0 && lineCount + 1 > maxLines) {
-                while (!result.empty() && (result.back() == '\n' || result.back() == ' ')) result.pop_back();
-                result += "...";
-                return result;
-            }
-            result += line;
-            lineCount += 1;
-        }
-    }
-
-    return result;
-}
-
 LevelManager::LevelManager()
     : gameState(GameState::TUTORIAL),
       currentLevel(0),
@@ -176,6 +92,14 @@ LevelManager::LevelManager()
     levelStartText.setFillColor(sf::Color::White);
     levelStartText.setPosition(300, 500);
 
+    // Rasterize the glyphs the HUD and banners use now, not on the frame they first appear
+    FontService::prewarm(font2, 20);                                   // tutorial dialog
+    FontService::prewarm(font2, 16);                                   // dialog skip prompt
+    FontService::prewarm(font4, 48);                                   // level start banner
+    FontService::prewarm(font4, 40, false, 2.f);                       // zombie counter
+    FontService::prewarm(font3, 48, false, 0.f, "0123456789/");        // equipped ammo panel
+    FontService::prewarm(font3, 26, false, 0.f, "0123456789/");        // other weapon ammo panel
+
     // FIGURABLE ROUND SETTINGS - edit values here to change per-round zombie behavior
     initializeDefaultConfigs();
 
@@ -235,6 +159,7 @@ void LevelManager::update(float deltaTime, Player& player) {
                       << " pendingTransition=" << (pendingLevelTransition ? 1 : 0)
                       << " inRoundTransition=" << (inRoundTransition ? 1 : 0)
                       << " levelTransitioning=" << (levelTransitioning ? 1 : 0)
+                      << " lod(full/reduced/kinematic)=" << lodCounts[0] << "/" << lodCounts[1] << "/" << lodCounts[2]
                       << std::endl;
             if (physicsWorld) {
                 std::cout << "             physics dynamic=" << physicsWorld->getDynamicBodyCount()
@@ -282,6 +207,10 @@ void LevelManager::update(float deltaTime, Player& player) {
         return;
     }
 
+    // Dormant (queued) zombies keep closing in on the player every tick
+    lastPlayerPos = player.getPosition();
+    if (!zombiesToSpawn.empty()) updateDormantZombies(deltaTime, lastPlayerPos);
+
     // Move queued zombies into the active list at intervals.
     if (zombiesSpawnedInRound < totalZombiesInRound && !zombiesToSpawn.empty()) {
         // Activate a limited number of queued zombies per frame to smooth CPU cost.
@@ -298,8 +227,20 @@ void LevelManager::update(float deltaTime, Player& player) {
         // Respect pacing interval
         if (zombieSpawnTimer >= zombieSpawnInterval) {
             // activate up to dynamicActivate (controlled pacing)
-            activateQueuedZombies(dynamicActivate, player.getPosition());
-            zombieSpawnTimer = 0.0f;
+            // Only restart the pacing timer once something was promoted, so the next
+            // dormant zombie to reach the ring activates right away
+            if (scheduler) {
+                // Promote one zombie per frame (once-per-frame step) so bursts spread across frames
+                pendingActivations = std::max(pendingActivations, dynamicActivate);
+                scheduler->enqueue("zombie-activate", FrameScheduler::Priority::HIGH, [this]() {
+                    if (pendingActivations <= 0) return false;
+                    if (activateQueuedZombies(1, lastPlayerPos) == 0) { pendingActivations = 0; return false; }
+                    zombieSpawnTimer = 0.0f;
+                    return --pendingActivations > 0;
+                }, true);
+            } else if (activateQueuedZombies(dynamicActivate, player.getPosition()) > 0) {
+                zombieSpawnTimer = 0.0f;
+            }
         }
     }
 
@@ -356,6 +297,7 @@ void LevelManager::update(float deltaTime, Player& player) {
                     // Play round-start sound when tally transition begins
                     levelStartSound.play();
                     roundStarted = false;
+                    startSpawnPlanning(player.getPosition());
                 } else {
                     setGameState(GameState::VICTORY);
                 }
@@ -373,18 +315,26 @@ void LevelManager::update(float deltaTime, Player& player) {
     }
 }
 
-void LevelManager::draw(sf::RenderWindow& window) {
-    drawZombies(window);
+void LevelManager::draw(sf::RenderTarget& window, RenderQueue& queue) {
+    drawZombies(window, queue);
 }
 
-void LevelManager::renderBullets(sf::RenderWindow& window, std::vector<std::unique_ptr<Bullet>>& bullets, float renderAlpha) {
+void LevelManager::renderBullets(sf::RenderTarget& window, std::vector<std::unique_ptr<Bullet>>& bullets, float renderAlpha) {
+    RenderStats::Scope statsScope(RenderStats::Subsystem::BULLETS);
+    sf::FloatRect visible = viewCullRect(window, bulletCullMargin);
+    bulletCull.reset();
     for (auto& b : bullets) {
+        const Vec2& p = b->getBody().position;
+        if (!visible.contains(p.x, p.y)) { ++bulletCull.culled; continue; }
+        ++bulletCull.drawn;
         b->setRenderAlpha(renderAlpha);
-        b->render(window);
+        b->render(worldBatch);
     }
+    worldBatch.flush(window);
 }
 
 void LevelManager::renderUI(sf::RenderWindow& window, sf::Font& font) {
+    RenderStats::Scope statsScope(RenderStats::Subsystem::HUD);
     // Existing dialog handling (unchanged)
     if (showingDialog && currentDialogIndex < tutorialDialogs.size()) {
         dialogText.setFont(this->font2);
@@ -396,7 +346,7 @@ void LevelManager::renderUI(sf::RenderWindow& window, sf::Font& font) {
         sf::Vector2u winSize = window.getSize();
         transitionRect.setSize(sf::Vector2f(static_cast<float>(winSize.x), static_cast<float>(winSize.y)));
         transitionRect.setPosition(0.f, 0.f);
-        window.draw(transitionRect);
+        RenderStats::draw(window, transitionRect);
     }
 
     if (levelTransitioning && (transitionState == TransitionState::FADE_IN || transitionState == TransitionState::SHOW_TEXT)) {
@@ -408,7 +358,7 @@ void LevelManager::renderUI(sf::RenderWindow& window, sf::Font& font) {
         levelStartText.setString(levelTextString);
         sf::Vector2u windowSize = window.getSize();
         levelStartText.setPosition((windowSize.x - levelStartText.getGlobalBounds().width) / 2, windowSize.y / 2 - 50);
-        window.draw(levelStartText);
+        RenderStats::draw(window, levelStartText);
     }
 
     // Draw round tally mark in top-right with cross-fade to upcoming texture during transitions.
@@ -420,15 +370,15 @@ void LevelManager::renderUI(sf::RenderWindow& window, sf::Font& font) {
         int currIdx = std::clamp(currentRound, 0, 4);
         int prevIdx = lastTallyIndex;
 
-        const sf::Texture* currTex = (currIdx >= 0) ? tallyTextures[currIdx] : nullptr;
-        const sf::Texture* prevTex = (prevIdx >= 0) ? tallyTextures[prevIdx] : nullptr;
+        const TextureRegion* currTex = (currIdx >= 0) ? &tallyTextures[currIdx] : nullptr;
+        const TextureRegion* prevTex = (prevIdx >= 0) ? &tallyTextures[prevIdx] : nullptr;
 
         // small top-right scale and larger center scale
         const float topRightScale = 0.6f; // smaller when shown in top-right
         const float centerScale = 1.4f;   // scale when centered (reduced from 1.8)
-        auto drawTallySprite = [&](const sf::Texture* tex, float alphaMul, float t) {
-            if (!tex) return;
-            sf::Sprite s; s.setTexture(*tex);
+        auto drawTallySprite = [&](const TextureRegion* tex, float alphaMul, float t) {
+            if (!tex || !tex->valid()) return;
+            sf::Sprite s; tex->applyTo(s);
             sf::Vector2u ts = tex->getSize();
             float baseW = static_cast<float>(ts.x);
             float baseH = static_cast<float>(ts.y);
@@ -446,7 +396,7 @@ void LevelManager::renderUI(sf::RenderWindow& window, sf::Font& font) {
             // compute alpha and apply only alpha so PNG colors remain intact
             sf::Uint8 a = static_cast<sf::Uint8>(255 * alphaMul);
             s.setColor(sf::Color(255, 255, 255, a));
-            window.draw(s);
+            RenderStats::draw(window, s);
             s.setColor(prev);
             };
 
@@ -477,18 +427,18 @@ void LevelManager::renderUI(sf::RenderWindow& window, sf::Font& font) {
             if (rt < moveInT) {
                 float tm = rt / moveInT; // 0..1 moving to center
                 float eased = easeInOutCubic(tm);
-                const sf::Texture* prevToMove = (lastTallyIndex >= 0) ? tallyTextures[lastTallyIndex] : prevTex;
+                const TextureRegion* prevToMove = (lastTallyIndex >= 0) ? &tallyTextures[lastTallyIndex] : prevTex;
                 drawTallySprite(prevToMove, 1.0f, eased);
             }
             else if (rt < moveInT + prevHoldT) {
-                const sf::Texture* prevToMove = (lastTallyIndex >= 0) ? tallyTextures[lastTallyIndex] : prevTex;
+                const TextureRegion* prevToMove = (lastTallyIndex >= 0) ? &tallyTextures[lastTallyIndex] : prevTex;
                 drawTallySprite(prevToMove, 1.0f, 1.0f);
             }
             else if (rt < moveInT + prevHoldT + newFadeInT) {
                 float sub = rt - (moveInT + prevHoldT);
                 float fadeT = sub / newFadeInT; // 0..1 crossfade
                 float easedFade = easeInOutCubic(fadeT);
-                const sf::Texture* prevToMove = (lastTallyIndex >= 0) ? tallyTextures[lastTallyIndex] : prevTex;
+                const TextureRegion* prevToMove = (lastTallyIndex >= 0) ? &tallyTextures[lastTallyIndex] : prevTex;
                 drawTallySprite(prevToMove, 1.0f - easedFade, 1.0f);
                 drawTallySprite(currTex, easedFade, 1.0f);
             }
@@ -539,7 +489,7 @@ void LevelManager::renderUI(sf::RenderWindow& window, sf::Font& font) {
         zombieCountText.setFillColor(sf::Color(255, 255, 255, alpha));
         zombieCountText.setOutlineColor(sf::Color(0, 0, 0, alpha));
         zombieCountText.setString("Zombies Left: " + std::to_string(zombies.size() + zombiesToSpawn.size()));
-        window.draw(zombieCountText);
+        RenderStats::draw(window, zombieCountText);
     }
 }
 
@@ -549,7 +499,19 @@ void LevelManager::nextLevel() {
     else loadLevel(nextLevelNumber);
 }
 
+void LevelManager::cancelDeferredWork() {
+    pendingActivations = 0;
+    poolTarget = static_cast<int>(zombiePool.size());
+    if (scheduler) {
+        scheduler->cancel("zombie-activate");
+        scheduler->cancel("zombie-pool");
+    }
+}
+
 void LevelManager::reset() {
+    cancelDeferredWork();
+    // Blood stains belong to the level; drop their tiles and anything still queued
+    Props::Explosion::clearGround();
     currentLevel = 0;
     currentRound = 0;
 
@@ -597,7 +559,7 @@ void LevelManager::startTutorial() {
     // Ensure tutorial uses the default round configs (in case they were modified at runtime)
     initializeDefaultConfigs();
     // Pre-allocate pool for expected tutorial zombies
-    ensurePoolSize(tutorialConfig.count);
+    requestPoolSize(tutorialConfig.count);
 }
 
 bool LevelManager::isTutorialComplete() const { return tutorialComplete; }
@@ -607,6 +569,8 @@ int LevelManager::getCurrentRound() const { return currentRound; }
 int LevelManager::getPreviousLevel() const { return previousLevel; }
 
 void LevelManager::loadLevel(int levelNumber) {
+    cancelDeferredWork();
+    Props::Explosion::clearGround();
     previousLevel = currentLevel;
     currentLevel = levelNumber;
     currentRound = 0;
@@ -622,6 +586,7 @@ void LevelManager::loadLevel(int levelNumber) {
     }
     zombies.clear();
     zombiesToSpawn.clear();
+    flowField.markObstaclesDirty();
     totalZombiesInRound = 0;
     zombiesSpawnedInRound = 0;
     zombiesKilledInRound = 0;
@@ -647,10 +612,13 @@ void LevelManager::loadLevel(int levelNumber) {
     }
     else {
         levelStartSound.play();
+        startSpawnPlanning(lastPlayerPos);
     }
 }
 
 void LevelManager::restartCurrentRound(const sf::Vector2f& playerPos) {
+    cancelDeferredWork();
+    Props::Explosion::clearGround();
         // Clear active zombies & recycle pool indices (same pattern used in loadLevel/reset)
         for (auto zb : zombies) {
         if (physicsWorld) physicsWorld->removeBody(&zb->getBody());
@@ -675,7 +643,7 @@ void LevelManager::restartCurrentRound(const sf::Vector2f& playerPos) {
     ZombieRoundConfig cfg;
     if (gameState == GameState::TUTORIAL) cfg = tutorialConfig;
     else cfg = roundConfigs[std::min(std::max(0, currentRound), 4)];
-    ensurePoolSize(cfg.count);
+    requestPoolSize(cfg.count);
     
     // spawnZombies will read currentRound and pick the correct round config
     spawnZombies(0, playerPos);
@@ -692,77 +660,94 @@ int LevelManager::getTotalRoundsForLevel(int level) const {
     }
 }
 
-void LevelManager::spawnZombies(int count, sf::Vector2f playerPos) {
-    // Prevent duplicate spawn requests if this round was already started
-    if (roundStarted) return;
+LevelManager::SpawnPlanInput LevelManager::makeSpawnPlanInput(const sf::Vector2f& playerPos) {
+    SpawnPlanInput in;
+    if (gameState == GameState::TUTORIAL) in.cfg = tutorialConfig;
+    else in.cfg = roundConfigs[std::min(std::max(0, currentRound), 4)];
+    in.roundIndex = std::min(std::max(0, currentRound), 4);
+    in.state = gameState;
+    in.playerPos = playerPos;
+    in.cameraViewRect = cameraViewRect;
+    in.mapSize = getMapSize();
+    in.seed = spawnSeedRng();
+    return in;
+}
 
-    zombiesToSpawn.clear();
-    totalZombiesInRound = count;
-    zombiesSpawnedInRound = 0;
-    zombiesKilledInRound = 0;
-    zombieSpawnTimer = 0.0f;
+void LevelManager::startSpawnPlanning(const sf::Vector2f& playerPos) {
+    // Plan the next round's spawns off the main thread while the transition banner plays.
+    // The planner only reads the copied input, so no locking is needed.
+    spawnPlanInput = makeSpawnPlanInput(playerPos);
+    spawnPlan = std::async(std::launch::async, &LevelManager::planSpawns, spawnPlanInput);
+}
+
+std::vector<LevelManager::SpawnRequest> LevelManager::planSpawns(const SpawnPlanInput& in) {
+    std::vector<SpawnRequest> plan;
+    const ZombieRoundConfig& cfg = in.cfg;
+    if (cfg.count <= 0) return plan;
+    plan.reserve(cfg.count);
 
-    std::random_device rd;
-    std::mt19937 gen(rd());
+    std::mt19937 gen(in.seed);
     std::uniform_int_distribution<> sideDist(0, 3);
 
-    sf::Vector2f mapSize = getMapSize();
+    const sf::Vector2f& mapSize = in.mapSize;
+    const sf::FloatRect& view = in.cameraViewRect;
+    const sf::Vector2f& playerPos = in.playerPos;
     float spawnMargin = 8.0f;
 
-    const float viewBuffer = 50.0f;
     const float minDistance = 200.0f;
     const int maxAttemptsPerZombie = 18;
+    // Zombie bodies are 50 units wide; keep planned spawns from overlapping so the
+    // physics solver doesn't have to push freshly activated bodies apart
+    const float minSeparation = 56.0f;
+    const float minSeparation2 = minSeparation * minSeparation;
+
+    // Choose ring radius so spawns are off-screen: compute minimum radius to be outside camera rectangle
+    float halfW = view.width * 0.5f;
+    float halfH = view.height * 0.5f;
+    // distance from camera center to its corner (half-diagonal)
+    float camHalfDiag = std::sqrt(halfW*halfW + halfH*halfH);
+    float buffer = 32.0f; // extra buffer so spawns are comfortably off-screen
+    float camMinR = camHalfDiag + buffer;
+    float camMax = std::max(view.width, view.height);
+    float minR = std::max(minDistance, camMinR);
+    float maxR = minR + camMax * 0.8f; // allow some spread further out
+    std::uniform_real_distribution<float> angDist(0.0f, 2.0f * 3.14159265f);
+    std::uniform_real_distribution<float> radDist(minR, maxR);
+
+    // compute per-round animation speed: base cfg.animSpeed minus 0.01 per round index (faster each round)
+    float animForSpawn = std::max(0.01f, cfg.animSpeed - 0.01f * static_cast<float>(in.roundIndex));
+
+    auto overlapsPlanned = [&](float x, float y) {
+        for (const SpawnRequest& o : plan) {
+            float dx = o.x - x;
+            float dy = o.y - y;
+            if (dx*dx + dy*dy < minSeparation2) return true;
+        }
+        return false;
+    };
+    auto push = [&](float x, float y) {
+        SpawnRequest req; req.x = x; req.y = y; req.health = cfg.health; req.damage = cfg.damage; req.speed = cfg.speed;
+        req.animSpeed = animForSpawn;
+        plan.push_back(req);
+    };
 
-    ZombieRoundConfig cfg;
-    if (gameState == GameState::TUTORIAL) cfg = tutorialConfig;
-    else cfg = roundConfigs[std::min(std::max(0, currentRound), 4)];
-
-    int spawnCount = cfg.count;
-    totalZombiesInRound = spawnCount;
-
-    // Ensure pool can hold spawnCount zombies (simple heuristic)
-    ensurePoolSize(spawnCount);
-
-    // We'll queue spawn positions and create/activate only a few per frame to avoid stalls.
-    // Store spawn positions temporarily in zombiesToSpawn as actual zombie objects (deferred activation)
-    for (int i = 0; i < spawnCount; ++i) {
+    for (int i = 0; i < cfg.count; ++i) {
         bool placed = false;
         for (int attempt = 0; attempt < maxAttemptsPerZombie; ++attempt) {
             // Sample a position around the player in polar coordinates so zombies surround the player
-            float sx = 0.0f, sy = 0.0f;
-            // Choose ring radius so spawns are off-screen: compute minimum radius to be outside camera rectangle
-            float halfW = cameraViewRect.width * 0.5f;
-            float halfH = cameraViewRect.height * 0.5f;
-            // distance from camera center to its corner (half-diagonal)
-            float camHalfDiag = std::sqrt(halfW*halfW + halfH*halfH);
-            float buffer = 32.0f; // extra buffer so spawns are comfortably off-screen
-            float camMinR = camHalfDiag + buffer;
-            float camMax = std::max(cameraViewRect.width, cameraViewRect.height);
-            float minR = std::max(minDistance, camMinR);
-            float maxR = minR + camMax * 0.8f; // allow some spread further out
-            std::uniform_real_distribution<float> angDist(0.0f, 2.0f * 3.14159265f);
-            std::uniform_real_distribution<float> radDist(minR, maxR);
             float ang = angDist(gen);
             float r = radDist(gen);
-            sx = playerPos.x + std::cos(ang) * r;
-            sy = playerPos.y + std::sin(ang) * r;
+            float sx = playerPos.x + std::cos(ang) * r;
+            float sy = playerPos.y + std::sin(ang) * r;
 
             // Reject samples that land inside the current camera view (spawn must be off-screen)
-            if (cameraViewRect.contains(sx, sy)) {
-                continue; // try another sample
-            }
+            if (view.contains(sx, sy)) continue;
+            // Reject samples overlapping an already planned spawn
+            if (overlapsPlanned(sx, sy)) continue;
 
             // Allow spawns outside the map bounds so zombies can enter from off-map.
             // Do not clamp or reject these samples; they will walk in toward the player.
-
-            // Create zombie but *don't* add to physics world yet. We'll add bodies gradually
-            LevelManager::SpawnRequest req; req.x = sx; req.y = sy; req.health = cfg.health; req.damage = cfg.damage; req.speed = cfg.speed;
-            // compute per-round animation speed: base cfg.animSpeed minus 0.01 per round index (faster each round)
-            float baseAnim = cfg.animSpeed;
-            int roundIndex = std::min(std::max(0, currentRound), 4);
-            float animForSpawn = std::max(0.01f, baseAnim - 0.01f * static_cast<float>(roundIndex));
-            req.animSpeed = animForSpawn;
-            zombiesToSpawn.push_back(req);
+            push(sx, sy);
             placed = true;
             break;
         }
@@ -773,89 +758,170 @@ void LevelManager::spawnZombies(int count, sf::Vector2f playerPos) {
             do {
                 int side = sideDist(gen);
                 switch (side) {
-                    case 0: x = -spawnMargin; y = std::uniform_real_distribution<>(0, mapSize.y)(gen); break;
-                    case 1: x = mapSize.x + spawnMargin; y = std::uniform_real_distribution<>(0, mapSize.y)(gen); break;
-                    case 2: x = std::uniform_real_distribution<>(0, mapSize.x)(gen); y = -spawnMargin; break;
-                    default: x = std::uniform_real_distribution<>(0, mapSize.x)(gen); y = mapSize.y + spawnMargin; break;
+                    case 0: x = -spawnMargin; y = std::uniform_real_distribution<float>(0, mapSize.y)(gen); break;
+                    case 1: x = mapSize.x + spawnMargin; y = std::uniform_real_distribution<float>(0, mapSize.y)(gen); break;
+                    case 2: x = std::uniform_real_distribution<float>(0, mapSize.x)(gen); y = -spawnMargin; break;
+                    default: x = std::uniform_real_distribution<float>(0, mapSize.x)(gen); y = mapSize.y + spawnMargin; break;
                 }
                 float dx = x - playerPos.x;
                 float dy = y - playerPos.y;
-                if (std::sqrt(dx*dx + dy*dy) >= minDistance) break;
+                if (std::sqrt(dx*dx + dy*dy) >= minDistance && !overlapsPlanned(x, y)) break;
                 attempts++;
             } while (attempts < 8);
-            LevelManager::SpawnRequest req; req.x = x; req.y = y; req.health = cfg.health; req.damage = cfg.damage; req.speed = cfg.speed;
-            float baseAnim = cfg.animSpeed;
-            int roundIndex = std::min(std::max(0, currentRound), 4);
-            float animForSpawn = std::max(0.01f, baseAnim - 0.01f * static_cast<float>(roundIndex));
-            req.animSpeed = animForSpawn;
-            zombiesToSpawn.push_back(req);
+            push(x, y);
+        }
+    }
+    return plan;
+}
+
+void LevelManager::spawnZombies(int count, sf::Vector2f playerPos) {
+    // Prevent duplicate spawn requests if this round was already started
+    if (roundStarted) return;
+
+    zombiesToSpawn.clear();
+    totalZombiesInRound = count;
+    zombiesSpawnedInRound = 0;
+    zombiesKilledInRound = 0;
+    zombieSpawnTimer = 0.0f;
+
+    SpawnPlanInput in = makeSpawnPlanInput(playerPos);
+    int spawnCount = in.cfg.count;
+    totalZombiesInRound = spawnCount;
+
+    // Ensure pool can hold spawnCount zombies (simple heuristic)
+    requestPoolSize(spawnCount);
+
+    // Use the plan prepared during the transition when it was made for this round;
+    // otherwise (first load, restarts) plan synchronously.
+    bool usedAsyncPlan = false;
+    if (spawnPlan.valid()) {
+        std::vector<SpawnRequest> plan = spawnPlan.get();
+        if (spawnPlanInput.state == in.state && spawnPlanInput.roundIndex == in.roundIndex
+            && static_cast<int>(plan.size()) == spawnCount) {
+            // The player kept moving during the banner: shift the ring so it stays centred
+            // on them (and therefore off-screen)
+            sf::Vector2f shift = playerPos - spawnPlanInput.playerPos;
+            for (SpawnRequest& req : plan) { req.x += shift.x; req.y += shift.y; }
+            zombiesToSpawn = std::move(plan);
+            usedAsyncPlan = true;
         }
     }
+    if (!usedAsyncPlan) zombiesToSpawn = planSpawns(in);
+
     roundStarted = true;
  }
 
-void LevelManager::activateQueuedZombies(int maxToActivate, const sf::Vector2f& playerPos) {
+void LevelManager::updateDormantZombies(float deltaTime, const sf::Vector2f& playerPos) {
+    // Queued spawns walk toward the player as bare points (no body, sprite or animator)
+    // and wait on the activation ring until the pacing timer promotes them.
+    float radius = getDormantActivationRadius();
+    for (SpawnRequest& req : zombiesToSpawn) {
+        float dx = playerPos.x - req.x;
+        float dy = playerPos.y - req.y;
+        float dist = std::sqrt(dx*dx + dy*dy);
+        float room = dist - radius;
+        if (room <= 0.0f) continue;
+
+        Vec2 dir(dx / dist, dy / dist);
+        Vec2 fieldDir;
+        if (flowField.sample(Vec2(req.x, req.y), fieldDir)) dir = fieldDir;
+        float step = std::min(req.speed * deltaTime, room);
+        req.x += dir.x * step;
+        req.y += dir.y * step;
+    }
+}
+
+float LevelManager::getDormantActivationRadius() const {
+    // Never promote inside the visible area: keep the ring outside the camera's half-diagonal
+    float halfW = cameraViewRect.width * 0.5f;
+    float halfH = cameraViewRect.height * 0.5f;
+    return std::max(dormantActivationRadius, std::sqrt(halfW*halfW + halfH*halfH) + 64.0f);
+}
 
+int LevelManager::activateQueuedZombies(int maxToActivate, const sf::Vector2f& playerPos) {
+    // Promote dormant spawns that reached the activation ring into pooled zombies
+    // (adds physics bodies). Nearest first so the closest pressure becomes real first.
+    float radius = getDormantActivationRadius() + 1.0f;
+    float radius2 = radius * radius;
     int activated = 0;
-    // We'll prefer to activate zombies that are nearer to the player first so expensive physics
-    // bodies are only created when the zombie is potentially relevant. This reduces CPU & cache
-    // pressure when large numbers of zombies are queued far away.
-    
-    // Simple approach: scan queue up to a limit, find candidates within a threshold distance and activate them.
-    const float immediateActivateDist = 1200.0f; // world units
-    const int scanLimit = std::min((size_t)50, zombiesToSpawn.size());
-
-    // Try to activate up to maxToActivate using proximity heuristic
-    for (int pass = 0; pass < 2 && activated < maxToActivate; ++pass) {
-        // pass 0: prefer closer than immediateActivateDist
-        // pass 1: fallback to activating any remaining queued
-        for (int i = 0; i < scanLimit && activated < maxToActivate && !zombiesToSpawn.empty(); ++i) {
-            // Access front element cheaply
-            LevelManager::SpawnRequest req = zombiesToSpawn.front();
-            // For pass 0, if too far skip by rotating queue
-            float dx = req.x - playerPos.x;
-            float dy = req.y - playerPos.y;
-            float dist2 = dx*dx + dy*dy;
-            bool shouldActivate = (pass == 1) || (dist2 <= immediateActivateDist * immediateActivateDist);
-
-            if (!shouldActivate) {
-                // rotate to back to avoid repeated checks next frame
-                zombiesToSpawn.pop_front();
-                zombiesToSpawn.push_back(req);
-                continue;
-            }
 
-            // Activate this one
-            zombiesToSpawn.pop_front();
-            if (freeZombieIndices.empty()) break;
-            int poolIdx = freeZombieIndices.front();
-            freeZombieIndices.pop_front();
-            ZombieWalker* z = zombiePool[poolIdx].get();
+    while (activated < maxToActivate && !zombiesToSpawn.empty() && !freeZombieIndices.empty()) {
+        int best = -1;
+        float bestDist2 = radius2;
+        for (size_t i = 0; i < zombiesToSpawn.size(); ++i) {
+            float dx = zombiesToSpawn[i].x - playerPos.x;
+            float dy = zombiesToSpawn[i].y - playerPos.y;
+            float d2 = dx*dx + dy*dy;
+            if (d2 <= bestDist2) { bestDist2 = d2; best = static_cast<int>(i); }
+        }
+        if (best < 0) break; // nothing on the ring yet; dormant zombies are still walking in
+
+        LevelManager::SpawnRequest req = zombiesToSpawn[best];
+        // swap-remove keeps the dormant array flat
+        zombiesToSpawn[best] = zombiesToSpawn.back();
+        zombiesToSpawn.pop_back();
 
-            // Reset zombie via public API
-            z->resetForSpawn(req.x, req.y, req.health, req.damage, req.speed);
-            // Apply per-spawn animation speed if supported (computed when queued)
-            z->setWalkFrameTime(req.animSpeed);
-            if (shadowTexture) z->setShadowTexture(*shadowTexture);
+        int poolIdx = freeZombieIndices.front();
+        freeZombieIndices.pop_front();
+        ZombieWalker* z = zombiePool[poolIdx].get();
 
-            // Register in physics world now
-            if (physicsWorld) physicsWorld->addBody(&z->getBody(), false);
+        // Reset zombie via public API
+        z->resetForSpawn(req.x, req.y, req.health, req.damage, req.speed);
+        // Apply per-spawn animation speed if supported (computed when queued)
+        z->setWalkFrameTime(req.animSpeed);
+        if (shadowTexture) z->setShadowTexture(*shadowTexture);
+        z->setFlowField(&flowField);
+        z->setLodPhase(poolIdx);
 
-            // Add pointer into active list and index mapping
-            zombies.push_back(z);
-            poolIndexByPtr[z] = poolIdx;
+        // Register in physics world now
+        if (physicsWorld) physicsWorld->addBody(&z->getBody(), false);
 
-            zombiesSpawnedInRound++;
-            activated++;
-        }
+        // Add pointer into active list and index mapping
+        zombies.push_back(z);
+        poolIndexByPtr[z] = poolIdx;
+
+        zombiesSpawnedInRound++;
+        activated++;
     }
+    return activated;
 }
 
 void LevelManager::updateZombies(float deltaTime, const Player& player) {
-    // Update active zombies
+    // Refresh the shared flow field (no-op unless the player moved to a new cell)
+    flowField.update(player.getPhysicsPosition(), physicsWorld);
+
+    // Update active zombies according to their AI LOD tier
     // Use index-based loop since zombies vector may be modified during iteration
+    sf::Vector2f playerPos = player.getPhysicsPosition();
+    ++aiTick;
+    lodCounts[0] = lodCounts[1] = lodCounts[2] = 0;
     for (size_t i = 0; i < zombies.size(); ++i) {
-        zombies[i]->update(deltaTime, player.getPhysicsPosition());
+        BaseZombie* zb = zombies[i];
+        ZombieLod prevTier = zb->getLod();
+        ZombieLod tier = chooseLod(zb);
+        zb->setLod(tier);
+        lodCounts[static_cast<int>(tier)]++;
+
+        if (tier == ZombieLod::FULL) {
+            // Catch up on any time skipped in a cheaper tier when promoted
+            zb->update(zb->consumeLodTime(deltaTime, true), playerPos);
+        } else if (tier == ZombieLod::REDUCED) {
+            // Staggered by pool slot so reduced zombies don't all update on the same tick.
+            // Promotion from kinematic runs immediately to restore facing and animation.
+            bool due = ((aiTick + static_cast<unsigned int>(zb->getLodPhase())) % static_cast<unsigned int>(lodReducedInterval)) == 0;
+            bool runNow = due || prevTier == ZombieLod::KINEMATIC;
+            float dt = zb->consumeLodTime(deltaTime, runNow);
+            if (runNow) {
+                zb->update(dt, playerPos);
+            } else {
+                // Body keeps moving with its last velocity; just advance interpolation
+                zb->syncInterpolation();
+            }
+        } else {
+            // Kinematic steering doesn't replay skipped time; just drop it
+            zb->consumeLodTime(0.0f, true);
+            zb->updateKinematic(deltaTime, playerPos);
+        }
     }
 
     // Remove dead zombies and recycle them back into the pool
@@ -896,31 +962,206 @@ void LevelManager::updateZombies(float deltaTime, const Player& player) {
     }
 }
 
-void LevelManager::drawZombies(sf::RenderWindow& window) const {
-    for (const auto& zombie : zombies) zombie->draw(window);
+ZombieLod LevelManager::chooseLod(const BaseZombie* zombie) const {
+    // Zombies mid-attack stay at full detail so the attack animation and damage window resolve
+    if (zombie->isAttacking()) return ZombieLod::FULL;
+
+    // Distance from the zombie to the camera view rectangle (0 when inside)
+    sf::Vector2f p = zombie->getPosition();
+    float dx = std::max({ cameraViewRect.left - p.x, 0.0f, p.x - (cameraViewRect.left + cameraViewRect.width) });
+    float dy = std::max({ cameraViewRect.top - p.y, 0.0f, p.y - (cameraViewRect.top + cameraViewRect.height) });
+    float d = std::sqrt(dx * dx + dy * dy);
+
+    // Demoting requires crossing the boundary plus hysteresis; promoting happens at the boundary
+    ZombieLod current = zombie->getLod();
+    float fullLimit = lodFullMargin + (current == ZombieLod::FULL ? lodHysteresis : 0.0f);
+    float reducedLimit = lodReducedMargin + (current != ZombieLod::KINEMATIC ? lodHysteresis : 0.0f);
+    if (d <= fullLimit) return ZombieLod::FULL;
+    if (d <= reducedLimit) return ZombieLod::REDUCED;
+    return ZombieLod::KINEMATIC;
+}
+
+void LevelManager::drawZombies(sf::RenderTarget& window, RenderQueue& queue) {
+    // Scope tags the queued quads; they are drawn when Game flushes the queue
+    RenderStats::Scope statsScope(RenderStats::Subsystem::ZOMBIES);
+    sf::FloatRect visible = viewCullRect(window, zombieCullMargin);
+    zombieCull.reset();
+    for (const auto& zombie : zombies) {
+        sf::Vector2f p = zombie->getPosition();
+        if (!visible.contains(p)) { ++zombieCull.culled; continue; }
+        ++zombieCull.drawn;
+        zombie->draw(queue);
+        if (worldOverlay) zombie->drawHealthBar(*worldOverlay);
+    }
 }
 
 std::vector<BaseZombie*>& LevelManager::getZombies() { return zombies; }
 
+// HUD layout shared by the widget drawers and the retained-cache regions
+namespace {
+    const float kHudBarWidth = 340.f;
+    const float kHudBarHeight = 10.f;
+    const float kHudPadding = 20.f;
+    const float kHudSpacing = 8.f;
+    const float kHudVerticalRaise = 20.f;
+    const float kHudContainerPad = 10.f;
+    const float kHudPanelWidth = 240.f;
+    const float kHudPanelHeight = 64.f;
+    const float kHudPanelPadding = 16.f;
+    const float kHudPanelGap = 5.f;
+    // room left of the bottom panel for the equip key icon
+    const float kHudKeyIconRoom = 64.f;
+
+    // Premultiplied-alpha compositing for the HUD cache: drawing into a transparent
+    // render texture with BlendAlpha leaves colors already multiplied by alpha.
+    const sf::BlendMode kPremultipliedAlpha(sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha);
+
+    bool createHudCanvas(sf::RenderTexture& canvas, unsigned int w, unsigned int h) {
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4996)
+        bool ok = canvas.create(w, h);
+#pragma warning(pop)
+#else
+        bool ok = canvas.create(w, h);
+#endif
+        return ok;
+    }
+
+    // Wipe a rect of the cache back to transparent without blending
+    void clearHudRegion(sf::RenderTexture& canvas, const sf::FloatRect& r) {
+        sf::RectangleShape wipe(sf::Vector2f(r.width, r.height));
+        wipe.setPosition(r.left, r.top);
+        wipe.setFillColor(sf::Color::Transparent);
+        RenderStats::draw(canvas, wipe, sf::RenderStates(sf::BlendNone));
+    }
+}
+
+float LevelManager::damageFlashEdge(float healthPercent) const {
+    if ((damageFlashRemaining <= 0.0f && damageFlashHoldRemaining <= 0.0f) || damageFlashStartPercent <= healthPercent) return healthPercent;
+    float t = 1.0f;
+    if (damageFlashHoldRemaining > 0.0f) {
+        // hold phase: t==1.0, flash at full width
+        t = 1.0f;
+    } else {
+        // shrinking phase uses remaining/duration
+        t = damageFlashRemaining / damageFlashDuration; // 1->0
+    }
+    // current flash edge moves from damageFlashStartPercent -> healthPercent as t goes 1->0
+    return healthPercent + (damageFlashStartPercent - healthPercent) * t;
+}
+
+void LevelManager::invalidateHud() {
+    hudBarsKey = HudBarsKey();
+    hudPanelsKey = HudPanelsKey();
+}
+
 void LevelManager::drawHUD(sf::RenderWindow& window, const Player& player) {
+    RenderStats::Scope statsScope(RenderStats::Subsystem::HUD);
     sf::Vector2u windowSize = window.getSize();
-    float barWidth = 200;
-    float barHeight = 20;
-    float padding = 10;
 
+    // Screen rects of the two corner widgets. The cache only holds these two rects side by
+    // side, so it costs a fraction of a window's VRAM and compositing touches no other pixels.
+    float winW = static_cast<float>(windowSize.x);
+    float winH = static_cast<float>(windowSize.y);
+    float barsTop = winH - kHudPadding - kHudVerticalRaise - kHudBarHeight * 2.f - kHudSpacing - kHudContainerPad - 2.f;
+    sf::FloatRect barsRect(0.f, barsTop, kHudPadding + kHudBarWidth + kHudContainerPad + 2.f, winH - barsTop);
+    float panelsTop = winH - kHudPanelPadding - kHudPanelHeight * 0.55f - kHudVerticalRaise - kHudPanelGap - kHudPanelHeight - 2.f;
+    float panelsLeft = std::max(0.f, winW - kHudPanelPadding - kHudPanelWidth - kHudKeyIconRoom);
+    sf::FloatRect panelsRect(panelsLeft, panelsTop, winW - panelsLeft, winH - panelsTop);
+    sf::Vector2u cacheSize(static_cast<unsigned int>(std::ceil(barsRect.width + panelsRect.width)),
+                           static_cast<unsigned int>(std::ceil(std::max(barsRect.height, panelsRect.height))));
+
+    if (!hudCacheReady || hudCache.getSize() != cacheSize) {
+        hudCacheReady = createHudCanvas(hudCache, cacheSize.x, cacheSize.y);
+        if (hudCacheReady) {
+            hudCache.clear(sf::Color::Transparent);
+            invalidateHud();
+        }
+    }
+    if (!hudCacheReady) {
+        // No render texture available: draw immediately every frame
+        drawHudBars(window, windowSize, player);
+        drawHudPanels(window, windowSize, player);
+        return;
+    }
+
+    // Widget inputs, quantized to what is visible (whole pixels of bar width)
+    float healthPercent = 0.0f;
+    if (player.getMaxHealth() > 0.0f) healthPercent = std::clamp(player.getCurrentHealth() / player.getMaxHealth(), 0.0f, 1.0f);
+    float staminaPercent = 0.0f;
+    if (player.getMaxStamina() > 0.0f) staminaPercent = std::clamp(player.getCurrentStamina() / player.getMaxStamina(), 0.0f, 1.0f);
+    HudBarsKey bars;
+    bars.healthPx = static_cast<int>(std::lround(kHudBarWidth * healthPercent));
+    bars.staminaPx = static_cast<int>(std::lround(kHudBarWidth * staminaPercent));
+    bars.flashPx = static_cast<int>(std::lround(kHudBarWidth * damageFlashEdge(healthPercent)));
+
+    HudPanelsKey panels;
+    panels.weapon = static_cast<int>(player.getCurrentWeapon());
+    panels.ammo = player.getCurrentAmmo();
+    panels.magazine = player.getMagazineSize();
+    panels.otherAmmo = (player.getCurrentWeapon() == WeaponType::PISTOL) ? player.getRifleAmmoInMag() : player.getPistolAmmoInMag();
+
+    // Bars occupy the left of the cache, panels the right; each is drawn through a view
+    // mapping its screen rect onto its slot, so the widgets keep their window coordinates
+    sf::Vector2f cs(static_cast<float>(cacheSize.x), static_cast<float>(cacheSize.y));
+    sf::FloatRect barsSlot(0.f, 0.f, barsRect.width, barsRect.height);
+    sf::FloatRect panelsSlot(barsRect.width, 0.f, panelsRect.width, panelsRect.height);
+
+    bool barsDirty = !(bars == hudBarsKey);
+    bool panelsDirty = !(panels == hudPanelsKey);
+    if (barsDirty) {
+        sf::View v(barsRect);
+        v.setViewport(sf::FloatRect(barsSlot.left / cs.x, 0.f, barsSlot.width / cs.x, barsSlot.height / cs.y));
+        hudCache.setView(v);
+        clearHudRegion(hudCache, barsRect);
+        drawHudBars(hudCache, windowSize, player);
+        hudBarsKey = bars;
+    }
+    if (panelsDirty) {
+        sf::View v(panelsRect);
+        v.setViewport(sf::FloatRect(panelsSlot.left / cs.x, 0.f, panelsSlot.width / cs.x, panelsSlot.height / cs.y));
+        hudCache.setView(v);
+        clearHudRegion(hudCache, panelsRect);
+        drawHudPanels(hudCache, windowSize, player);
+        hudPanelsKey = panels;
+    }
+    if (barsDirty || panelsDirty) {
+        hudCache.display();
+        ++hudRedrawCount;
+    }
+
+    // Composite both widgets with a single draw of two quads
+    hudQuads.clear();
+    const sf::FloatRect* screen[2] = { &barsRect, &panelsRect };
+    const sf::FloatRect* slot[2] = { &barsSlot, &panelsSlot };
+    for (int i = 0; i < 2; ++i) {
+        const sf::FloatRect& r = *screen[i];
+        const sf::FloatRect& t = *slot[i];
+        sf::Vertex tl(sf::Vector2f(r.left, r.top), sf::Vector2f(t.left, t.top));
+        sf::Vertex tr(sf::Vector2f(r.left + r.width, r.top), sf::Vector2f(t.left + t.width, t.top));
+        sf::Vertex br(sf::Vector2f(r.left + r.width, r.top + r.height), sf::Vector2f(t.left + t.width, t.top + t.height));
+        sf::Vertex bl(sf::Vector2f(r.left, r.top + r.height), sf::Vector2f(t.left, t.top + t.height));
+        hudQuads.append(tl); hudQuads.append(tr); hudQuads.append(br);
+        hudQuads.append(tl); hudQuads.append(br); hudQuads.append(bl);
+    }
+    RenderStats::draw(window, hudQuads, sf::RenderStates(kPremultipliedAlpha, sf::Transform::Identity, &hudCache.getTexture(), nullptr));
+}
+
+void LevelManager::drawHudBars(sf::RenderTarget& window, const sf::Vector2u& windowSize, const Player& player) {
     // Draw health and stamina bars in bottom-left
     // Longer and skinnier bars
-    float hudBarWidth = 340.f;
-    float hudBarHeight = 10.f;
-    float hudPadding = 20.f;
-    float hudSpacing = 8.f;
+    float hudBarWidth = kHudBarWidth;
+    float hudBarHeight = kHudBarHeight;
+    float hudPadding = kHudPadding;
+    float hudSpacing = kHudSpacing;
     // Vertical raise for HUD elements (positive moves them upward)
-    float hudVerticalRaise = 20.f; // tweak this value to move bars/panels up/down
+    float hudVerticalRaise = kHudVerticalRaise; // tweak this value to move bars/panels up/down
     float hudStaminaY = static_cast<float>(windowSize.y) - hudBarHeight - hudPadding - hudVerticalRaise;
     float hudHealthY = hudStaminaY - hudBarHeight - hudSpacing;
 
     // Container backdrop behind bars: draw a left-opaque -> right-transparent gradient
-    float containerPad = 10.f;
+    float containerPad = kHudContainerPad;
     float containerX = hudPadding - containerPad;
     float containerY = hudHealthY - containerPad;
     float containerW = hudBarWidth + containerPad * 2.f;
@@ -940,7 +1181,7 @@ void LevelManager::drawHUD(sf::RenderWindow& window, const Player& player) {
     grad[4].position = sf::Vector2f(containerX, containerY + containerH); grad[4].color = opaqueCol; // bottom-left
     grad[5].position = sf::Vector2f(containerX + containerW, containerY + containerH); grad[5].color = transparentCol; // bottom-right
 
-    window.draw(grad);
+    RenderStats::draw(window, grad);
 
     // Backgrounds
     sf::RectangleShape healthBg(sf::Vector2f(hudBarWidth, hudBarHeight));
@@ -971,299 +1212,287 @@ void LevelManager::drawHUD(sf::RenderWindow& window, const Player& player) {
     staminaFill.setFillColor(sf::Color::White);
     staminaFill.setPosition(hudPadding, hudStaminaY);
 
-    window.draw(healthBg);
-    window.draw(healthFill);
+    RenderStats::draw(window, healthBg);
+    RenderStats::draw(window, healthFill);
     // If a damage flash is active, draw the missing portion as red on top of the health bar
-    if ((damageFlashRemaining > 0.0f || damageFlashHoldRemaining > 0.0f) && damageFlashStartPercent > healthPercent) {
-        float t = 1.0f;
-        if (damageFlashHoldRemaining > 0.0f) {
-            // hold phase: t==1.0, flash at full width
-            t = 1.0f;
-        } else {
-            // shrinking phase uses remaining/duration
-            t = damageFlashRemaining / damageFlashDuration; // 1->0
-        }
-        // current flash edge moves from damageFlashStartPercent -> healthPercent as t goes 1->0
-        float currentFlashEdge = healthPercent + (damageFlashStartPercent - healthPercent) * t;
-        float redWidth = hudBarWidth * (currentFlashEdge - healthPercent);
-        if (redWidth > 0.0f) {
-            sf::RectangleShape redFill(sf::Vector2f(redWidth, hudBarHeight));
-            redFill.setFillColor(sf::Color(200, 40, 40, 220));
-            redFill.setPosition(hudPadding + hudBarWidth * healthPercent, hudHealthY);
-            window.draw(redFill);
-        }
+    float redWidth = hudBarWidth * (damageFlashEdge(healthPercent) - healthPercent);
+    if (redWidth > 0.0f) {
+        sf::RectangleShape redFill(sf::Vector2f(redWidth, hudBarHeight));
+        redFill.setFillColor(sf::Color(200, 40, 40, 220));
+        redFill.setPosition(hudPadding + hudBarWidth * healthPercent, hudHealthY);
+        RenderStats::draw(window, redFill);
     }
-    window.draw(staminaBg);
-    window.draw(staminaFill);
+    RenderStats::draw(window, staminaBg);
+    RenderStats::draw(window, staminaFill);
+}
 
+void LevelManager::drawHudPanels(sf::RenderTarget& window, const sf::Vector2u& windowSize, const Player& player) {
     // Two stacked dark transparent panels in bottom-right with padding between them
-    {
-        const float panelWidth = 240.f;
-        const float panelHeight = 64.f;
-        const float panelPadding = 16.f; // distance from screen edges
-        const float gap = 5.f; // space between stacked panels
-
-        float xTop = static_cast<float>(windowSize.x) - panelPadding - panelWidth;
-        // smaller dimensions for bottom panel
-        float panelBWidth = panelWidth * 0.82f;
-        float panelBHeight = panelHeight * 0.55f;
-        float xBottom = static_cast<float>(windowSize.x) - panelPadding - panelBWidth; // smaller than top
-        // bottom panel (panel B) anchored to bottom edge
-        float yBottom = static_cast<float>(windowSize.y) - panelPadding - panelBHeight - hudVerticalRaise;
-        // top panel (panel A) sits above bottom panel with gap
-        float yTop = yBottom - gap - panelHeight;
-
-        sf::RectangleShape panelA(sf::Vector2f(panelWidth, panelHeight));
-        panelA.setPosition(xTop, yTop);
-        panelA.setFillColor(sf::Color(0, 0, 0, 160)); // dark, semi-transparent
-
-        sf::RectangleShape panelB(sf::Vector2f(panelBWidth, panelBHeight));
-        panelB.setPosition(xBottom, yBottom);
-        panelB.setFillColor(sf::Color(0, 0, 0, 160));
-
-        window.draw(panelA);
-        // Draw lower panel so it is visible (must be drawn before top panel outlines)
-        window.draw(panelB);
-
-        // Draw weapon icons INSIDE the panels. Draw these before the outlines/bracket lines
-        // so the white accent lines remain visible on top.
-        const float iconPadding = 2.0f; // small padding inside panel
-        // drawIconInPanel now takes an optional size multiplier. It clamps the final scale
-        // so the sprite never draws outside the available panel area.
-        auto drawIconInPanel = [&](const sf::Texture* tex, float px, float py, float pW, float pH, float mul = 1.0f) {
-             if (!tex) return;
-             sf::Sprite s; s.setTexture(*tex);
-             float texW = static_cast<float>(tex->getSize().x);
-             float texH = static_cast<float>(tex->getSize().y);
-             float availW = pW - iconPadding * 2.0f;
-             float availH = pH - iconPadding * 2.0f;
-             if (availW <= 0 || availH <= 0 || texW <= 0 || texH <= 0) return;
-             // base scale that fits the texture into the available box
-             float baseScale = std::min(availW / texW, availH / texH);
-             // apply multiplier but clamp to the maximum that still fits
-             float appliedScale = baseScale * mul;
-             s.setScale(appliedScale, appliedScale);
-             float drawW = texW * appliedScale;
-             float drawH = texH * appliedScale;
-             // center inside panel area (respect padding)
-             float posX = px + (pW - drawW) * 0.5f;
-             float posY = py + (pH - drawH) * 0.5f;
-             s.setPosition(posX, posY);
-             window.draw(s);
-         };
-
-        const sf::Texture* topTex = nullptr;
-        const sf::Texture* bottomTex = nullptr;
-        if (player.getCurrentWeapon() == WeaponType::PISTOL) {
-            topTex = pistolIcon;
-            bottomTex = rifleIcon;
-        } else {
-            topTex = rifleIcon;
-            bottomTex = pistolIcon;
-        }
-        // Use per-icon scale multipliers (1.0 = fit to panel). Apply the correct scale
-        // to the top (equipped) and bottom (other) icon depending on the player's weapon.
-        float topMul = 1.0f;
-        float bottomMul = 1.0f;
-        if (player.getCurrentWeapon() == WeaponType::PISTOL) {
-            // pistol is on top panel
-            topMul = pistolTopScale;
-            bottomMul = rifleBottomScale;
-        } else {
-            // rifle is on top panel
-            topMul = rifleTopScale;
-            bottomMul = pistolBottomScale;
-        }
+    const float panelWidth = kHudPanelWidth;
+    const float panelHeight = kHudPanelHeight;
+    const float panelPadding = kHudPanelPadding; // distance from screen edges
+    const float gap = kHudPanelGap; // space between stacked panels
+
+    float xTop = static_cast<float>(windowSize.x) - panelPadding - panelWidth;
+    // smaller dimensions for bottom panel
+    float panelBWidth = panelWidth * 0.82f;
+    float panelBHeight = panelHeight * 0.55f;
+    float xBottom = static_cast<float>(windowSize.x) - panelPadding - panelBWidth; // smaller than top
+    // bottom panel (panel B) anchored to bottom edge
+    float yBottom = static_cast<float>(windowSize.y) - panelPadding - panelBHeight - kHudVerticalRaise;
+    // top panel (panel A) sits above bottom panel with gap
+    float yTop = yBottom - gap - panelHeight;
+
+    sf::RectangleShape panelA(sf::Vector2f(panelWidth, panelHeight));
+    panelA.setPosition(xTop, yTop);
+    panelA.setFillColor(sf::Color(0, 0, 0, 160)); // dark, semi-transparent
+
+    sf::RectangleShape panelB(sf::Vector2f(panelBWidth, panelBHeight));
+    panelB.setPosition(xBottom, yBottom);
+    panelB.setFillColor(sf::Color(0, 0, 0, 160));
+
+    RenderStats::draw(window, panelA);
+    // Draw lower panel so it is visible (must be drawn before top panel outlines)
+    RenderStats::draw(window, panelB);
+
+    // Draw weapon icons INSIDE the panels. Draw these before the outlines/bracket lines
+    // so the white accent lines remain visible on top.
+    const float iconPadding = 2.0f; // small padding inside panel
+    // drawIconInPanel now takes an optional size multiplier. It clamps the final scale
+    // so the sprite never draws outside the available panel area.
+    auto drawIconInPanel = [&](const TextureRegion* tex, float px, float py, float pW, float pH, float mul = 1.0f) {
+         if (!tex || !tex->valid()) return;
+         sf::Sprite s; tex->applyTo(s);
+         float texW = static_cast<float>(tex->getSize().x);
+         float texH = static_cast<float>(tex->getSize().y);
+         float availW = pW - iconPadding * 2.0f;
+         float availH = pH - iconPadding * 2.0f;
+         if (availW <= 0 || availH <= 0 || texW <= 0 || texH <= 0) return;
+         // base scale that fits the texture into the available box
+         float baseScale = std::min(availW / texW, availH / texH);
+         // apply multiplier but clamp to the maximum that still fits
+         float appliedScale = baseScale * mul;
+         s.setScale(appliedScale, appliedScale);
+         float drawW = texW * appliedScale;
+         float drawH = texH * appliedScale;
+         // center inside panel area (respect padding)
+         float posX = px + (pW - drawW) * 0.5f;
+         float posY = py + (pH - drawH) * 0.5f;
+         s.setPosition(posX, posY);
+         RenderStats::draw(window, s);
+     };
+
+    const TextureRegion* topTex = nullptr;
+    const TextureRegion* bottomTex = nullptr;
+    if (player.getCurrentWeapon() == WeaponType::PISTOL) {
+        topTex = &pistolIcon;
+        bottomTex = &rifleIcon;
+    } else {
+        topTex = &rifleIcon;
+        bottomTex = &pistolIcon;
+    }
+    // Use per-icon scale multipliers (1.0 = fit to panel). Apply the correct scale
+    // to the top (equipped) and bottom (other) icon depending on the player's weapon.
+    float topMul = 1.0f;
+    float bottomMul = 1.0f;
+    if (player.getCurrentWeapon() == WeaponType::PISTOL) {
+        // pistol is on top panel
+        topMul = pistolTopScale;
+        bottomMul = rifleBottomScale;
+    } else {
+        // rifle is on top panel
+        topMul = rifleTopScale;
+        bottomMul = pistolBottomScale;
+    }
 
-        // Compute debug line X (same fraction used later) so we can center icons between panel left and the line
-        const float debugFrac = 0.55f; // same fraction used for TEMP debug line
-        float lx = xTop + panelWidth * debugFrac;
-
-        // Draw an icon centered between the left edge of the panel (px) and the vertical line lx.
-        auto drawIconCenteredBetween = [&](const sf::Texture* tex, float px, float py, float pW, float pH, float mul, float lineX) {
-             if (!tex) return;
-             sf::Sprite s; s.setTexture(*tex);
-             float texW = static_cast<float>(tex->getSize().x);
-             float texH = static_cast<float>(tex->getSize().y);
-
-             const float pad = 2.0f;
-             // horizontal slot is from px+pad .. lineX - pad
-             float slotLeft = px + pad;
-             float slotRight = lineX - pad;
-             float slotW = slotRight - slotLeft;
-             if (slotW < 8.f) slotW = std::max(8.f, pW - pad*2.f);
-             // vertical slot uses panel height
-             float slotH = pH - pad * 2.0f;
-             if (slotH < 8.f) slotH = pH - pad*2.f;
-
-             // Compute baseScale to fit inside the slot (respecting both width and height)
-             float baseScale = 1.0f;
-             if (texW > 0 && texH > 0) baseScale = std::min(slotW / texW, slotH / texH);
-             float appliedScale = baseScale * mul;
-             s.setScale(appliedScale, appliedScale);
-
-             float drawW = texW * appliedScale;
-             float drawH = texH * appliedScale;
-
-             // center inside the horizontal slot and vertically inside panel
-             float posX = slotLeft + (slotW - drawW) * 0.5f;
-             float posY = py + pad + (slotH - drawH) * 0.5f;
-             s.setPosition(posX, posY);
-             window.draw(s);
-         };
-
-        // Draw icons centered between their panel left edge and the debug line lx
-        drawIconCenteredBetween(topTex, xTop, yTop, panelWidth, panelHeight, topMul, lx);
-        drawIconCenteredBetween(bottomTex, xBottom, yBottom, panelBWidth, panelBHeight, bottomMul, lx);
-
-        // Draw key icon to the left of the bottom panel indicating which key equips the unequipped weapon
-        // Draw the PNG at its original pixel size (no scaling). If texture missing, draw nothing.
-        {
-            WeaponType topW = player.getCurrentWeapon();
-            WeaponType bottomW = (topW == WeaponType::PISTOL) ? WeaponType::RIFLE : WeaponType::PISTOL;
-            const sf::Texture* ktex = (bottomW == WeaponType::RIFLE) ? keyIcon1 : keyIcon2;
-            if (ktex && ktex->getSize().x > 0 && ktex->getSize().y > 0) {
-                sf::Sprite ks; ks.setTexture(*ktex);
-                // place sprite to the left of the bottom panel with a small gap
-                float gapBox = 8.0f;
-                // use original texture size in pixels
-                sf::Vector2u ts = ktex->getSize();
-                float spriteW = static_cast<float>(ts.x);
-                float spriteH = static_cast<float>(ts.y);
-                // compute position so sprite is vertically centered relative to bottom panel
-                float boxX = xBottom - gapBox - spriteW;
-                float boxY = yBottom + (panelBHeight - spriteH) * 0.5f;
-                ks.setScale(1.0f, 1.0f);
-                ks.setPosition(boxX, boxY);
-                window.draw(ks);
-            }
+    // Compute debug line X (same fraction used later) so we can center icons between panel left and the line
+    const float debugFrac = 0.55f; // same fraction used for TEMP debug line
+    float lx = xTop + panelWidth * debugFrac;
+
+    // Draw an icon centered between the left edge of the panel (px) and the vertical line lx.
+    auto drawIconCenteredBetween = [&](const TextureRegion* tex, float px, float py, float pW, float pH, float mul, float lineX) {
+         if (!tex || !tex->valid()) return;
+         sf::Sprite s; tex->applyTo(s);
+         float texW = static_cast<float>(tex->getSize().x);
+         float texH = static_cast<float>(tex->getSize().y);
+
+         const float pad = 2.0f;
+         // horizontal slot is from px+pad .. lineX - pad
+         float slotLeft = px + pad;
+         float slotRight = lineX - pad;
+         float slotW = slotRight - slotLeft;
+         if (slotW < 8.f) slotW = std::max(8.f, pW - pad*2.f);
+         // vertical slot uses panel height
+         float slotH = pH - pad * 2.0f;
+         if (slotH < 8.f) slotH = pH - pad*2.f;
+
+         // Compute baseScale to fit inside the slot (respecting both width and height)
+         float baseScale = 1.0f;
+         if (texW > 0 && texH > 0) baseScale = std::min(slotW / texW, slotH / texH);
+         float appliedScale = baseScale * mul;
+         s.setScale(appliedScale, appliedScale);
+
+         float drawW = texW * appliedScale;
+         float drawH = texH * appliedScale;
+
+         // center inside the horizontal slot and vertically inside panel
+         float posX = slotLeft + (slotW - drawW) * 0.5f;
+         float posY = py + pad + (slotH - drawH) * 0.5f;
+         s.setPosition(posX, posY);
+         RenderStats::draw(window, s);
+     };
+
+    // Draw icons centered between their panel left edge and the debug line lx
+    drawIconCenteredBetween(topTex, xTop, yTop, panelWidth, panelHeight, topMul, lx);
+    drawIconCenteredBetween(bottomTex, xBottom, yBottom, panelBWidth, panelBHeight, bottomMul, lx);
+
+    // Draw key icon to the left of the bottom panel indicating which key equips the unequipped weapon
+    // Draw the PNG at its original pixel size (no scaling). If texture missing, draw nothing.
+    {
+        WeaponType topW = player.getCurrentWeapon();
+        WeaponType bottomW = (topW == WeaponType::PISTOL) ? WeaponType::RIFLE : WeaponType::PISTOL;
+        const TextureRegion& ktex = (bottomW == WeaponType::RIFLE) ? keyIcon1 : keyIcon2;
+        if (ktex.valid()) {
+            sf::Sprite ks; ktex.applyTo(ks);
+            // place sprite to the left of the bottom panel with a small gap
+            float gapBox = 8.0f;
+            // use original texture size in pixels
+            sf::Vector2u ts = ktex.getSize();
+            float spriteW = static_cast<float>(ts.x);
+            float spriteH = static_cast<float>(ts.y);
+            // compute position so sprite is vertically centered relative to bottom panel
+            float boxX = xBottom - gapBox - spriteW;
+            float boxY = yBottom + (panelBHeight - spriteH) * 0.5f;
+            ks.setScale(1.0f, 1.0f);
+            ks.setPosition(boxX, boxY);
+            RenderStats::draw(window, ks);
         }
+    }
 
-        // For the top panel, draw the equipped weapon's ammo right-aligned inside the panel
-        {
-            int topAmmo = player.getCurrentAmmo();
-            int topMag = player.getMagazineSize();
-
-            sf::Text leftAmmoTop;
-            sf::Text rightAmmoTop;
-            leftAmmoTop.setFont(this->font3);
-            rightAmmoTop.setFont(this->font3);
-            unsigned int topCharSize = static_cast<unsigned int>(std::max(10.f, panelHeight * 0.75f));
-            leftAmmoTop.setCharacterSize(topCharSize);
-            rightAmmoTop.setCharacterSize(topCharSize);
-            leftAmmoTop.setFillColor(sf::Color::White);
-            rightAmmoTop.setFillColor(sf::Color(160,160,160));
-            leftAmmoTop.setString(std::to_string(topAmmo));
-            rightAmmoTop.setString(std::string("/") + std::to_string(topMag));
-
-            sf::FloatRect lbTop = leftAmmoTop.getLocalBounds();
-            sf::FloatRect rbTop = rightAmmoTop.getLocalBounds();
-            float totalWTop = (lbTop.width + lbTop.left) + (rbTop.width + rbTop.left);
-            float textStartXTop = xTop + panelWidth - 10.f - totalWTop; // 10px right padding
-            float textYTop = yTop + (panelHeight - (lbTop.height)) * 0.5f - lbTop.top;
-            leftAmmoTop.setPosition(textStartXTop - 4.f, textYTop);
-            rightAmmoTop.setPosition(textStartXTop + (lbTop.width + lbTop.left), textYTop);
-            window.draw(leftAmmoTop);
-            window.draw(rightAmmoTop);
-        }
+    // For the top panel, draw the equipped weapon's ammo right-aligned inside the panel
+    {
+        int topAmmo = player.getCurrentAmmo();
+        int topMag = player.getMagazineSize();
+
+        sf::Text leftAmmoTop;
+        sf::Text rightAmmoTop;
+        leftAmmoTop.setFont(this->font3);
+        rightAmmoTop.setFont(this->font3);
+        unsigned int topCharSize = static_cast<unsigned int>(std::max(10.f, panelHeight * 0.75f));
+        leftAmmoTop.setCharacterSize(topCharSize);
+        rightAmmoTop.setCharacterSize(topCharSize);
+        leftAmmoTop.setFillColor(sf::Color::White);
+        rightAmmoTop.setFillColor(sf::Color(160,160,160));
+        leftAmmoTop.setString(std::to_string(topAmmo));
+        rightAmmoTop.setString(std::string("/") + std::to_string(topMag));
+
+        sf::FloatRect lbTop = leftAmmoTop.getLocalBounds();
+        sf::FloatRect rbTop = rightAmmoTop.getLocalBounds();
+        float totalWTop = (lbTop.width + lbTop.left) + (rbTop.width + rbTop.left);
+        float textStartXTop = xTop + panelWidth - 10.f - totalWTop; // 10px right padding
+        float textYTop = yTop + (panelHeight - (lbTop.height)) * 0.5f - lbTop.top;
+        leftAmmoTop.setPosition(textStartXTop - 4.f, textYTop);
+        rightAmmoTop.setPosition(textStartXTop + (lbTop.width + lbTop.left), textYTop);
+        RenderStats::draw(window, leftAmmoTop);
+        RenderStats::draw(window, rightAmmoTop);
+    }
 
-        // For the bottom panel, draw the unequipped weapon's ammo right-aligned inside the panel
-        {
-            WeaponType topW = player.getCurrentWeapon();
-            WeaponType bottomW = (topW == WeaponType::PISTOL) ? WeaponType::RIFLE : WeaponType::PISTOL;
-            int ammoVal = 0;
-            int magVal = 0;
-            if (bottomW == WeaponType::PISTOL) {
-                ammoVal = player.getPistolAmmoInMag();
-                magVal = 12; // pistol mag size
-            } else {
-                ammoVal = player.getRifleAmmoInMag();
-                magVal = 30; // rifle mag size
-            }
-            std::string ammoStr = std::to_string(ammoVal) + "/" + std::to_string(magVal);
-
-            // Render ammo as two parts: current ammo (white) and "/mag" (grey) so the slash and right numbers are grey
-            sf::Text leftAmmoText;
-            leftAmmoText.setFont(this->font3);
-            sf::Text rightAmmoText;
-            rightAmmoText.setFont(this->font3);
-            unsigned int charSize = static_cast<unsigned int>(std::max(10.f, panelBHeight * 0.75f));
-            leftAmmoText.setCharacterSize(charSize);
-            rightAmmoText.setCharacterSize(charSize);
-            leftAmmoText.setFillColor(sf::Color::White);
-            rightAmmoText.setFillColor(sf::Color(160,160,160)); // grey for slash and mag
-            leftAmmoText.setString(std::to_string(ammoVal));
-            rightAmmoText.setString(std::string("/") + std::to_string(magVal));
-
-            // Measure both parts to right-align the pair inside the bottom panel
-            sf::FloatRect lb = leftAmmoText.getLocalBounds();
-            sf::FloatRect rb = rightAmmoText.getLocalBounds();
-            float totalW = (lb.width + lb.left) + (rb.width + rb.left);
-            float textStartX = xBottom + panelBWidth - 10.f - totalW; // 10px right padding
-            float textY = yBottom + (panelBHeight - (lb.height)) * 0.5f - lb.top;
-            leftAmmoText.setPosition(textStartX - 4.f, textY);
-            rightAmmoText.setPosition(textStartX + (lb.width + lb.left), textY);
-            window.draw(leftAmmoText);
-            window.draw(rightAmmoText);
-         }
-
-        // Solid white side outlines on top panel
-         float outlineW = 2.0f;
-         sf::RectangleShape leftOutline(sf::Vector2f(outlineW, panelHeight));
-         leftOutline.setPosition(xTop, yTop);
-         leftOutline.setFillColor(sf::Color::White);
-         window.draw(leftOutline);
-
-         sf::RectangleShape rightOutline(sf::Vector2f(outlineW, panelHeight));
-         rightOutline.setPosition(xTop + panelWidth - outlineW, yTop);
-         rightOutline.setFillColor(sf::Color::White);
-         window.draw(rightOutline);
-
-         // Horizontal bracket lines that extend slightly inward from each side
-         float horizLen = panelWidth * 0.03f; // how far the bracket extends inward
-         float horizTh = outlineW; // thickness matches side outline
-         float vertInset = 0.0f; // vertical inset from top/bottom edges
-
-         // Top-left horizontal
-         sf::RectangleShape topLeftHor(sf::Vector2f(horizLen, horizTh));
-         topLeftHor.setPosition(xTop + outlineW, yTop + vertInset);
-         topLeftHor.setFillColor(sf::Color::White);
-         window.draw(topLeftHor);
-
-         // Bottom-left horizontal
-         sf::RectangleShape bottomLeftHor(sf::Vector2f(horizLen, horizTh));
-         bottomLeftHor.setPosition(xTop + outlineW, yTop + panelHeight - vertInset - horizTh);
-         bottomLeftHor.setFillColor(sf::Color::White);
-         window.draw(bottomLeftHor);
-
-         // Top-right horizontal (extends leftwards)
-         sf::RectangleShape topRightHor(sf::Vector2f(horizLen, horizTh));
-         topRightHor.setPosition(xTop + panelWidth - outlineW - horizLen, yTop + vertInset);
-         topRightHor.setFillColor(sf::Color::White);
-         window.draw(topRightHor);
-
-         // Bottom-right horizontal
-         sf::RectangleShape bottomRightHor(sf::Vector2f(horizLen, horizTh));
-         bottomRightHor.setPosition(xTop + panelWidth - outlineW - horizLen, yTop + panelHeight - vertInset - horizTh);
-         bottomRightHor.setFillColor(sf::Color::White);
-         window.draw(bottomRightHor);
-
-        // TEMP: draw a vertical debug line at 45% of the top panel width and continue it through the bottom panel
-        {
-            float frac = 0.55f; // fraction across the top panel where the line should be
-            float lx = xTop + panelWidth * frac;
-            // start at top panel top, end at bottom panel bottom (covers the gap between panels)
-            float yStart = yTop;
-            float yEnd = yBottom + panelBHeight;
-            sf::VertexArray vline(sf::Lines, 2);
-            vline[0].position = sf::Vector2f(lx, yStart);
-            vline[1].position = sf::Vector2f(lx, yEnd);
-            // Make debug line invisible by using fully transparent color
-            sf::Color dbgCol(255, 64, 64, 0);
-            vline[0].color = dbgCol;
-            vline[1].color = dbgCol;
-            window.draw(vline);
+    // For the bottom panel, draw the unequipped weapon's ammo right-aligned inside the panel
+    {
+        WeaponType topW = player.getCurrentWeapon();
+        WeaponType bottomW = (topW == WeaponType::PISTOL) ? WeaponType::RIFLE : WeaponType::PISTOL;
+        int ammoVal = 0;
+        int magVal = 0;
+        if (bottomW == WeaponType::PISTOL) {
+            ammoVal = player.getPistolAmmoInMag();
+            magVal = 12; // pistol mag size
+        } else {
+            ammoVal = player.getRifleAmmoInMag();
+            magVal = 30; // rifle mag size
         }
+        std::string ammoStr = std::to_string(ammoVal) + "/" + std::to_string(magVal);
+
+        // Render ammo as two parts: current ammo (white) and "/mag" (grey) so the slash and right numbers are grey
+        sf::Text leftAmmoText;
+        leftAmmoText.setFont(this->font3);
+        sf::Text rightAmmoText;
+        rightAmmoText.setFont(this->font3);
+        unsigned int charSize = static_cast<unsigned int>(std::max(10.f, panelBHeight * 0.75f));
+        leftAmmoText.setCharacterSize(charSize);
+        rightAmmoText.setCharacterSize(charSize);
+        leftAmmoText.setFillColor(sf::Color::White);
+        rightAmmoText.setFillColor(sf::Color(160,160,160)); // grey for slash and mag
+        leftAmmoText.setString(std::to_string(ammoVal));
+        rightAmmoText.setString(std::string("/") + std::to_string(magVal));
+
+        // Measure both parts to right-align the pair inside the bottom panel
+        sf::FloatRect lb = leftAmmoText.getLocalBounds();
+        sf::FloatRect rb = rightAmmoText.getLocalBounds();
+        float totalW = (lb.width + lb.left) + (rb.width + rb.left);
+        float textStartX = xBottom + panelBWidth - 10.f - totalW; // 10px right padding
+        float textY = yBottom + (panelBHeight - (lb.height)) * 0.5f - lb.top;
+        leftAmmoText.setPosition(textStartX - 4.f, textY);
+        rightAmmoText.setPosition(textStartX + (lb.width + lb.left), textY);
+        RenderStats::draw(window, leftAmmoText);
+        RenderStats::draw(window, rightAmmoText);
+     }
+
+    // Solid white side outlines on top panel
+     float outlineW = 2.0f;
+     sf::RectangleShape leftOutline(sf::Vector2f(outlineW, panelHeight));
+     leftOutline.setPosition(xTop, yTop);
+     leftOutline.setFillColor(sf::Color::White);
+     RenderStats::draw(window, leftOutline);
+
+     sf::RectangleShape rightOutline(sf::Vector2f(outlineW, panelHeight));
+     rightOutline.setPosition(xTop + panelWidth - outlineW, yTop);
+     rightOutline.setFillColor(sf::Color::White);
+     RenderStats::draw(window, rightOutline);
+
+     // Horizontal bracket lines that extend slightly inward from each side
+     float horizLen = panelWidth * 0.03f; // how far the bracket extends inward
+     float horizTh = outlineW; // thickness matches side outline
+     float vertInset = 0.0f; // vertical inset from top/bottom edges
+
+     // Top-left horizontal
+     sf::RectangleShape topLeftHor(sf::Vector2f(horizLen, horizTh));
+     topLeftHor.setPosition(xTop + outlineW, yTop + vertInset);
+     topLeftHor.setFillColor(sf::Color::White);
+     RenderStats::draw(window, topLeftHor);
+
+     // Bottom-left horizontal
+     sf::RectangleShape bottomLeftHor(sf::Vector2f(horizLen, horizTh));
+     bottomLeftHor.setPosition(xTop + outlineW, yTop + panelHeight - vertInset - horizTh);
+     bottomLeftHor.setFillColor(sf::Color::White);
+     RenderStats::draw(window, bottomLeftHor);
+
+     // Top-right horizontal (extends leftwards)
+     sf::RectangleShape topRightHor(sf::Vector2f(horizLen, horizTh));
+     topRightHor.setPosition(xTop + panelWidth - outlineW - horizLen, yTop + vertInset);
+     topRightHor.setFillColor(sf::Color::White);
+     RenderStats::draw(window, topRightHor);
+
+     // Bottom-right horizontal
+     sf::RectangleShape bottomRightHor(sf::Vector2f(horizLen, horizTh));
+     bottomRightHor.setPosition(xTop + panelWidth - outlineW - horizLen, yTop + panelHeight - vertInset - horizTh);
+     bottomRightHor.setFillColor(sf::Color::White);
+     RenderStats::draw(window, bottomRightHor);
+
+    // TEMP: draw a vertical debug line at 45% of the top panel width and continue it through the bottom panel
+    {
+        float frac = 0.55f; // fraction across the top panel where the line should be
+        float lx = xTop + panelWidth * frac;
+        // start at top panel top, end at bottom panel bottom (covers the gap between panels)
+        float yStart = yTop;
+        float yEnd = yBottom + panelBHeight;
+        sf::VertexArray vline(sf::Lines, 2);
+        vline[0].position = sf::Vector2f(lx, yStart);
+        vline[1].position = sf::Vector2f(lx, yEnd);
+        // Make debug line invisible by using fully transparent color
+        sf::Color dbgCol(255, 64, 64, 0);
+        vline[0].color = dbgCol;
+        vline[1].color = dbgCol;
+        RenderStats::draw(window, vline);
     }
 }
 
@@ -1280,16 +1509,18 @@ void LevelManager::showTutorialDialog(sf::RenderWindow& window) {
         float baseLineHeight = dialogText.getCharacterSize() * 1.2f;
         int maxLines = static_cast<int>((dialogBox.getSize().y - padding * 2.0f) / baseLineHeight);
         if (maxLines < 1) maxLines = 1;
-        std::string wrapped = wrapText(dialogText, tutorialDialogs[currentDialogIndex], maxTextWidth, maxLines);
+        std::string wrapped = dialogText.getFont()
+            ? FontService::wrap(*dialogText.getFont(), dialogText.getCharacterSize(), tutorialDialogs[currentDialogIndex], maxTextWidth, maxLines)
+            : tutorialDialogs[currentDialogIndex];
 
         // Draw dialog box and then each line separately with explicit spacing to avoid SFML auto-spacing issues
-        window.draw(dialogBox);
+        RenderStats::draw(window, dialogBox);
 
         // If dialog contains the special token "----" draw the Esc icon inline.
         const std::string token = "----";
         std::string original = tutorialDialogs[currentDialogIndex];
         bool dialogHasEscToken = (original.find(token) != std::string::npos);
-        if (dialogHasEscToken && keyIconEsc && keyIconEsc->getSize().x > 0) {
+        if (dialogHasEscToken && keyIconEsc.valid()) {
             // Manual layout: iterate words and place them, substituting icon for token with wrapping.
             float lineSpacingMul = 1.1f;
             float lineHeight = dialogText.getCharacterSize() * lineSpacingMul;
@@ -1306,7 +1537,7 @@ void LevelManager::showTutorialDialog(sf::RenderWindow& window) {
             while (ws >> word) {
                 if (word == token) {
                     // measure icon desired size to match text height
-                    sf::Vector2u its = keyIconEsc->getSize();
+                    sf::Vector2u its = keyIconEsc.getSize();
                     float desiredH = dialogText.getCharacterSize();
                     float scale = (its.y > 0) ? (desiredH / static_cast<float>(its.y)) : 1.0f;
                     float iconW = its.x * scale;
@@ -1316,20 +1547,20 @@ void LevelManager::showTutorialDialog(sf::RenderWindow& window) {
                         curX = startX; curY += lineHeight;
                     }
                     // draw icon
-                    sf::Sprite ks; ks.setTexture(*keyIconEsc);
+                    sf::Sprite ks; keyIconEsc.applyTo(ks);
                     ks.setScale(scale, scale);
                     ks.setPosition(curX, curY + (lineHeight - iconH) * 0.5f);
-                    window.draw(ks);
+                    RenderStats::draw(window, ks);
                     curX += iconW + tmp.getLetterSpacing();
                 } else {
                     // measure word width including a trailing space
                     tmp.setString(word + " ");
-                    float w = tmp.getLocalBounds().width;
+                    float w = FontService::measure(*tmp.getFont(), tmp.getCharacterSize(), word + " ");
                     if (curX + w > maxX) {
                         curX = startX; curY += lineHeight;
                     }
                     tmp.setPosition(curX, curY);
-                    window.draw(tmp);
+                    RenderStats::draw(window, tmp);
                     curX += w;
                 }
             }
@@ -1351,7 +1582,7 @@ void LevelManager::showTutorialDialog(sf::RenderWindow& window) {
             for (size_t i = 0; i < lines.size(); ++i) {
                 lineText.setString(lines[i]);
                 lineText.setPosition(startX, startY + static_cast<float>(i) * lineHeight);
-                window.draw(lineText);
+                RenderStats::draw(window, lineText);
             }
         }
         // Always draw the skip/continue prompt at bottom-right inside the dialog box
@@ -1365,10 +1596,10 @@ void LevelManager::showTutorialDialog(sf::RenderWindow& window) {
         float spX = dialogBox.getPosition().x + dialogBox.getSize().x - padding - (spb.width + spb.left);
         float spY = dialogBox.getPosition().y + dialogBox.getSize().y - padding - (spb.height + spb.top);
         skipPrompt.setPosition(spX, spY);
-        window.draw(skipPrompt);
+        RenderStats::draw(window, skipPrompt);
     } else {
         // still draw empty box if no dialog
-        window.draw(dialogBox);
+        RenderStats::draw(window, dialogBox);
         // draw the prompt even when dialog is empty
         sf::Text skipPrompt;
         skipPrompt.setFont(this->font2);
@@ -1385,7 +1616,7 @@ void LevelManager::showTutorialDialog(sf::RenderWindow& window) {
         float spX = dialogBox.getPosition().x + dialogBox.getSize().x - padding - (spb.width + spb.left);
         float spY = dialogBox.getPosition().y + dialogBox.getSize().y - padding - (spb.height + spb.top);
         skipPrompt.setPosition(spX, spY);
-        window.draw(skipPrompt);
+        RenderStats::draw(window, skipPrompt);
     }
 }
 
@@ -1398,9 +1629,9 @@ void LevelManager::notifyPlayerDeath() {
 }
 
 // Add missing method implementations
-void LevelManager::render(sf::RenderWindow& window) {
+void LevelManager::render(sf::RenderTarget& window, RenderQueue& queue) {
     // Render active world entities (zombies). Drawing of map/background is handled by Game.
-    draw(window);
+    draw(window, queue);
 }
 
 void LevelManager::setPhysicsWorld(PhysicsWorld* world) {
@@ -1411,6 +1642,13 @@ void LevelManager::setCameraViewRect(const sf::FloatRect& viewRect) {
     cameraViewRect = viewRect;
 }
 
+void LevelManager::setWorldSize(const sf::Vector2u& size) {
+    sf::FloatRect padded(-flowFieldMargin, -flowFieldMargin,
+                         static_cast<float>(size.x) + flowFieldMargin * 2.0f,
+                         static_cast<float>(size.y) + flowFieldMargin * 2.0f);
+    flowField.configure(padded, flowFieldCellSize);
+}
+
 sf::Vector2f LevelManager::getMapSize() const {
     // Return the current configured map bounds size (fallback to 800x600 if not initialized)
     sf::Vector2f s = mapBounds.getSize();
@@ -1424,17 +1662,28 @@ void LevelManager::ensurePoolSize(int desired) {
     int current = static_cast<int>(zombiePool.size());
     if (current >= desired) return;
     zombiePool.reserve(desired);
-    for (int i = current; i < desired; ++i) {
-        // Create at origin; resetForSpawn will position later when activated
-        auto z = std::make_unique<ZombieWalker>(0.0f, 0.0f);
-        // Assign shadow texture if available
-        if (shadowTexture) z->setShadowTexture(*shadowTexture);
-        freeZombieIndices.push_back(static_cast<int>(zombiePool.size()));
-        poolIndexByPtr[z.get()] = static_cast<int>(zombiePool.size());
-        zombiePool.push_back(std::move(z));
-        // Immediately mark as free by popping mapping (we only want poolIndexByPtr for active ones)
-        poolIndexByPtr.erase(zombiePool.back().get());
-    }
+    for (int i = current; i < desired; ++i) addPooledZombie();
+}
+
+void LevelManager::requestPoolSize(int desired) {
+    if (!scheduler) { ensurePoolSize(desired); return; }
+    if (desired <= static_cast<int>(zombiePool.size())) return;
+    poolTarget = std::max(poolTarget, desired);
+    // Construct one zombie per step so a large round start doesn't stall a single frame
+    scheduler->enqueue("zombie-pool", FrameScheduler::Priority::NORMAL, [this]() {
+        if (static_cast<int>(zombiePool.size()) < poolTarget) addPooledZombie();
+        return static_cast<int>(zombiePool.size()) < poolTarget;
+    });
+}
+
+void LevelManager::addPooledZombie() {
+    // Create at origin; resetForSpawn will position later when activated
+    auto z = std::make_unique<ZombieWalker>(0.0f, 0.0f);
+    // Assign shadow texture if available
+    if (shadowTexture) z->setShadowTexture(*shadowTexture);
+    z->setFlowField(&flowField);
+    freeZombieIndices.push_back(static_cast<int>(zombiePool.size()));
+    zombiePool.push_back(std::move(z));
 }
 
 void LevelManager::initializeDefaultConfigs() {
@@ -9,9 +9,19 @@
 #include <optional>
 #include <deque>
 #include <unordered_map>
+#include <future>
+#include <random>
 #include "Player.h"
 #include "ZombieWalker.h"
 #include "Bullet.h"
+#include "FlowField.h"
+#include "FrameScheduler.h"
+#include "SpriteBatch.h"
+#include "RenderQueue.h"
+#include "WorldOverlay.h"
+#include "ViewCulling.h"
+#include "TextureAtlas.h"
+#include "FontService.h"
 #include <chrono>
 #include <iomanip>
 
@@ -42,9 +52,10 @@ public:
     
     void initialize();
     void update(float deltaTime, Player& player);
-    void draw(sf::RenderWindow& window);
+    // Zombies are submitted to the frame's render queue; Game flushes it with the player
+    void draw(sf::RenderTarget& window, RenderQueue& queue);
     
-    void render(sf::RenderWindow& window);
+    void render(sf::RenderTarget& window, RenderQueue& queue);
     void renderUI(sf::RenderWindow& window, sf::Font& font);
     void nextLevel();
     void reset();
@@ -76,13 +87,16 @@ public:
     void setRoundConfig(int roundIndex, const ZombieRoundConfig& cfg) { if (roundIndex >= 0 && roundIndex < (int)roundConfigs.size()) roundConfigs[roundIndex] = cfg; }
     
     void updateZombies(float deltaTime, const Player& player);
-    void drawZombies(sf::RenderWindow& window) const;
+    void drawZombies(sf::RenderTarget& window, RenderQueue& queue);
     std::vector<BaseZombie*>& getZombies();
 
     // Render bullets managed by Game (LevelManager will draw them so ordering is managed centrally)
-    void renderBullets(sf::RenderWindow& window, std::vector<std::unique_ptr<Bullet>>& bullets, float renderAlpha);
+    void renderBullets(sf::RenderTarget& window, std::vector<std::unique_ptr<Bullet>>& bullets, float renderAlpha);
 
+    // Bars and weapon panels are retained in a window-sized render texture; each widget is
+    // redrawn into its region only when its inputs change, then the cache is drawn once.
     void drawHUD(sf::RenderWindow& window, const Player& player);
+    int getHudRedrawCount() const { return hudRedrawCount; }
     
     void showTutorialDialog(sf::RenderWindow& window);
     void advanceDialog();
@@ -90,29 +104,37 @@ public:
     sf::Vector2f getMapSize() const;
 
     void setPhysicsWorld(PhysicsWorld* world);
+    // Optional frame-budgeted scheduler for zombie activation and pool growth.
+    // Without one, that work runs inline as before.
+    void setScheduler(FrameScheduler* s) { scheduler = s; }
+    // World overlay that zombie health bars are queued into (flushed by Game)
+    void setWorldOverlay(WorldOverlay* overlay) { worldOverlay = overlay; }
     // Provide the current camera view rectangle (world coords) so spawn logic
     // can place zombies just outside the visible area.
     void setCameraViewRect(const sf::FloatRect& viewRect);
+    // Provide the current level's map size (world units) so the navigation flow field
+    // covers the playable area plus the off-map ring zombies spawn in.
+    void setWorldSize(const sf::Vector2u& size);
     // Shadow support: set a texture that will be assigned to spawned zombies
     void setShadowTexture(const sf::Texture& tex) { shadowTexture = &tex; }
-    // HUD weapon icons (set by Game when loading assets)
-    void setPistolIcon(const sf::Texture& tex) { pistolIcon = &tex; }
-    void setRifleIcon(const sf::Texture& tex) { rifleIcon = &tex; }
+    // HUD weapon icons (atlas regions set by Game when loading assets)
+    void setPistolIcon(const TextureRegion& region) { pistolIcon = region; invalidateHud(); }
+    void setRifleIcon(const TextureRegion& region) { rifleIcon = region; invalidateHud(); }
     // Optional key icons for HUD equip buttons (setters below)
-    void setKeyIcon1(const sf::Texture& tex);
-    void setKeyIcon2(const sf::Texture& tex);
-	void setKeyIconEsc(const sf::Texture& tex);
-    // Tally textures for rounds (0..4)
-    const sf::Texture* tallyTextures[5] = { nullptr, nullptr, nullptr, nullptr, nullptr };
-    void setTallyTexture(int index, const sf::Texture& tex) { if (index >= 0 && index < 5) tallyTextures[index] = &tex; }
+    void setKeyIcon1(const TextureRegion& region);
+    void setKeyIcon2(const TextureRegion& region);
+	void setKeyIconEsc(const TextureRegion& region);
+    // Tally regions for rounds (0..4)
+    TextureRegion tallyTextures[5];
+    void setTallyTexture(int index, const TextureRegion& region) { if (index >= 0 && index < 5) tallyTextures[index] = region; }
     // Per-icon scale multipliers (1.0 = fit to panel). Setters provided to tune different icon artwork sizes.
-    void setPistolIconScale(float s) { pistolIconScale = s; }
-    void setRifleIconScale(float s) { rifleIconScale = s; }
+    void setPistolIconScale(float s) { pistolIconScale = s; invalidateHud(); }
+    void setRifleIconScale(float s) { rifleIconScale = s; invalidateHud(); }
     // Per-weapon per-panel scales: allows tuning pistol/rifle sizes separately when shown in the top or bottom panel
-    void setPistolTopScale(float s) { pistolTopScale = s; }
-    void setPistolBottomScale(float s) { pistolBottomScale = s; }
-    void setRifleTopScale(float s) { rifleTopScale = s; }
-    void setRifleBottomScale(float s) { rifleBottomScale = s; }
+    void setPistolTopScale(float s) { pistolTopScale = s; invalidateHud(); }
+    void setPistolBottomScale(float s) { pistolBottomScale = s; invalidateHud(); }
+    void setRifleTopScale(float s) { rifleTopScale = s; invalidateHud(); }
+    void setRifleBottomScale(float s) { rifleBottomScale = s; invalidateHud(); }
     // Load per-round configs from a simple CSV-like file. See TDCod/Config/rounds.cfg for format.
     void loadConfigs(const std::string& path);
 
@@ -122,10 +144,27 @@ public:
     void notifyPlayerDeath();
     int getActiveZombieCount() const { return static_cast<int>(zombies.size()); }
     int getQueuedZombieCount() const { return static_cast<int>(zombiesToSpawn.size()); }
+    int getFlowFieldRebuildCount() const { return flowField.getRebuildCount(); }
+    // Number of active zombies in each AI LOD tier after the last update
+    int getLodCount(ZombieLod tier) const { return lodCounts[static_cast<int>(tier)]; }
+    // Zombies/bullets drawn vs. skipped by view culling in the last frame
+    const CullStats& getZombieCullStats() const { return zombieCull; }
+    const CullStats& getBulletCullStats() const { return bulletCull; }
+    // Bullet batch of the last frame (draw calls and quads)
+    const SpriteBatch& getWorldBatch() const { return worldBatch; }
     bool getDebugLogging() const { return debugLogging; }
 
 private:
     PhysicsWorld* physicsWorld = nullptr;
+    FrameScheduler* scheduler = nullptr;
+    // Reused every frame to draw bullets with one call per texture/blend mode
+    SpriteBatch worldBatch;
+    WorldOverlay* worldOverlay = nullptr;
+    CullStats zombieCull;
+    CullStats bulletCull;
+    // View margins used for culling: zombie sprites plus shadow/health bar, bullets plus their trailing sprite offset
+    float zombieCullMargin = 128.0f;
+    float bulletCullMargin = 64.0f;
     GameState gameState;
     int currentLevel;
     int previousLevel;
@@ -155,8 +194,28 @@ private:
         float animSpeed = 0.1f;
     };
 
-    // Queue of spawn requests (deferred allocation)
-    std::deque<SpawnRequest> zombiesToSpawn;
+    // Everything the spawn planner reads, copied so planning can run on a worker thread
+    struct SpawnPlanInput {
+        ZombieRoundConfig cfg;
+        int roundIndex = 0;
+        GameState state = GameState::TUTORIAL;
+        sf::Vector2f playerPos;
+        sf::FloatRect cameraViewRect;
+        sf::Vector2f mapSize;
+        unsigned int seed = 0;
+    };
+    SpawnPlanInput makeSpawnPlanInput(const sf::Vector2f& playerPos);
+    // Pure spawn placement: off-screen ring around the player, no overlaps between spawns
+    static std::vector<SpawnRequest> planSpawns(const SpawnPlanInput& in);
+    // Kick off background planning for the upcoming round (during transition banners)
+    void startSpawnPlanning(const sf::Vector2f& playerPos);
+    std::future<std::vector<SpawnRequest>> spawnPlan;
+    SpawnPlanInput spawnPlanInput;
+    std::mt19937 spawnSeedRng{ std::random_device{}() };
+
+    // Dormant zombies: queued spawn requests simulated as kinematic points in a flat
+    // array (position and speed, target = player) until promoted into the pool
+    std::vector<SpawnRequest> zombiesToSpawn;
 
     // Object pool of zombie instances (owns objects). Currently pooling ZombieWalker instances.
     std::vector<std::unique_ptr<ZombieWalker>> zombiePool;
@@ -165,11 +224,25 @@ private:
     // map from active pointer -> pool index for quick recycling
     std::unordered_map<BaseZombie*, int> poolIndexByPtr;
 
-    // Activate up to N queued zombies (adds physics bodies). Called from update().
-    // Modified to accept player position so activation can be deferred until zombies are near the player/camera.
-    void activateQueuedZombies(int maxToActivate = 1, const sf::Vector2f& playerPos = sf::Vector2f(0.f,0.f));
-    // Ensure pool capacity at least N
+    // Promote up to N dormant zombies that reached the activation ring (adds physics bodies). Called from update().
+    // Returns how many were promoted.
+    int activateQueuedZombies(int maxToActivate = 1, const sf::Vector2f& playerPos = sf::Vector2f(0.f,0.f));
+    // Advance dormant zombies toward the player, stopping at the activation ring
+    void updateDormantZombies(float deltaTime, const sf::Vector2f& playerPos);
+    // Activation ring radius, never smaller than what keeps promotions off-screen
+    float getDormantActivationRadius() const;
+    float dormantActivationRadius = 1200.0f;
+    // Ensure pool capacity at least N (synchronous; used at startup)
     void ensurePoolSize(int desired);
+    // Grow the pool to at least N, deferred through the scheduler one zombie per step
+    void requestPoolSize(int desired);
+    void addPooledZombie();
+    int poolTarget = 0;
+    // Promotions requested by the pacing timer but not yet run by the scheduler
+    int pendingActivations = 0;
+    // Drop queued activations and pool growth belonging to the level being left
+    void cancelDeferredWork();
+    sf::Vector2f lastPlayerPos = sf::Vector2f(0.f, 0.f);
 
     int totalZombiesInRound;
     int zombiesSpawnedInRound;
@@ -202,14 +275,31 @@ private:
     // in LevelManager.cpp under the clearly marked "CONFIGURABLE ROUND SETTINGS" region.
     void initializeDefaultConfigs();
 
+    // Shared navigation field toward the player, rebuilt only when the player changes cell
+    FlowField flowField;
+    float flowFieldCellSize = 64.0f;
+    float flowFieldMargin = 1024.0f; // padding around the map so off-map spawns can path in
+
+    // AI level of detail. Margins are world-unit distances outside the camera view:
+    // inside lodFullMargin zombies update every tick, inside lodReducedMargin every
+    // lodReducedInterval ticks, and beyond that they only steer as kinematic points.
+    // Demotion waits for an extra lodHysteresis so zombies on a boundary don't flip-flop.
+    float lodFullMargin = 200.0f;
+    float lodReducedMargin = 900.0f;
+    float lodHysteresis = 80.0f;
+    int lodReducedInterval = 4;
+    unsigned int aiTick = 0;
+    int lodCounts[3] = { 0, 0, 0 };
+    ZombieLod chooseLod(const BaseZombie* zombie) const;
+
     // Current camera view rect used when computing spawn positions
     sf::FloatRect cameraViewRect = sf::FloatRect(0.f, 0.f, 800.f, 600.f);
     const sf::Texture* shadowTexture = nullptr;
-    const sf::Texture* pistolIcon = nullptr;
-    const sf::Texture* rifleIcon = nullptr;
-    const sf::Texture* keyIcon1 = nullptr;
-    const sf::Texture* keyIcon2 = nullptr;
-    const sf::Texture* keyIconEsc = nullptr;
+    TextureRegion pistolIcon;
+    TextureRegion rifleIcon;
+    TextureRegion keyIcon1;
+    TextureRegion keyIcon2;
+    TextureRegion keyIconEsc;
     int lastTallyIndex = -1; // previous round index used for cross-fade animation
     float pistolIconScale = 1.5f; // legacy/global multiplier
     float rifleIconScale = 3.3f;  // legacy/global multiplier
@@ -231,6 +321,27 @@ private:
     // Hold time before the flash begins shrinking
     float damageFlashHold = 0.45f; // seconds to hold full red before shrinking
     float damageFlashHoldRemaining = 0.0f; // remaining hold time
+    // Right edge (as health percent) of the red flash segment; equals healthPercent when no flash is showing
+    float damageFlashEdge(float healthPercent) const;
+
+    // Retained HUD cache and the inputs each widget was last drawn with
+    struct HudBarsKey {
+        int healthPx = -1, staminaPx = -1, flashPx = -1;
+        bool operator==(const HudBarsKey& o) const { return healthPx == o.healthPx && staminaPx == o.staminaPx && flashPx == o.flashPx; }
+    };
+    struct HudPanelsKey {
+        int weapon = -1, ammo = -1, magazine = -1, otherAmmo = -1;
+        bool operator==(const HudPanelsKey& o) const { return weapon == o.weapon && ammo == o.ammo && magazine == o.magazine && otherAmmo == o.otherAmmo; }
+    };
+    sf::RenderTexture hudCache;
+    sf::VertexArray hudQuads{ sf::Triangles };
+    bool hudCacheReady = false;
+    HudBarsKey hudBarsKey;
+    HudPanelsKey hudPanelsKey;
+    int hudRedrawCount = 0;
+    void invalidateHud();
+    void drawHudBars(sf::RenderTarget& window, const sf::Vector2u& windowSize, const Player& player);
+    void drawHudPanels(sf::RenderTarget& window, const sf::Vector2u& windowSize, const Player& player);
     
 public:
     bool isRequireEscToAdvanceDialog() const {
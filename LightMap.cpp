@@ -0,0 +1,135 @@
+#include "LightMap.h"
+#include "RenderStats.h"
+#include "ViewCulling.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace {
+    // result = dst * src + src * dst: 2x modulate, destination alpha kept
+    const sf::BlendMode kModulate2x(sf::BlendMode::DstColor, sf::BlendMode::SrcColor, sf::BlendMode::Add,
+                                    sf::BlendMode::Zero, sf::BlendMode::One, sf::BlendMode::Add);
+
+    bool createBuffer(sf::RenderTexture& buffer, unsigned int w, unsigned int h) {
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4996)
+        bool ok = buffer.create(w, h);
+#pragma warning(pop)
+#else
+        bool ok = buffer.create(w, h);
+#endif
+        return ok;
+    }
+
+    void appendQuad(sf::VertexArray& va, const sf::FloatRect& r, const sf::FloatRect& uv, const sf::Color& c) {
+        sf::Vertex tl(sf::Vector2f(r.left, r.top), c, sf::Vector2f(uv.left, uv.top));
+        sf::Vertex tr(sf::Vector2f(r.left + r.width, r.top), c, sf::Vector2f(uv.left + uv.width, uv.top));
+        sf::Vertex br(sf::Vector2f(r.left + r.width, r.top + r.height), c, sf::Vector2f(uv.left + uv.width, uv.top + uv.height));
+        sf::Vertex bl(sf::Vector2f(r.left, r.top + r.height), c, sf::Vector2f(uv.left, uv.top + uv.height));
+        va.append(tl); va.append(tr); va.append(br);
+        va.append(tl); va.append(br); va.append(bl);
+    }
+}
+
+const sf::Texture& LightMap::falloffTexture() {
+    // Smooth radial falloff shared by every light, generated once
+    static sf::Texture texture;
+    static bool built = false;
+    if (!built) {
+        const unsigned int size = 128;
+        sf::Image image;
+        image.create(size, size, sf::Color::Black);
+        float c = (size - 1) * 0.5f;
+        for (unsigned int y = 0; y < size; ++y) {
+            for (unsigned int x = 0; x < size; ++x) {
+                float d = std::sqrt((x - c) * (x - c) + (y - c) * (y - c)) / c;
+                float f = std::clamp(1.0f - d, 0.0f, 1.0f);
+                sf::Uint8 v = static_cast<sf::Uint8>(f * f * 255.f);
+                image.setPixel(x, y, sf::Color(v, v, v));
+            }
+        }
+        texture.loadFromImage(image);
+        texture.setSmooth(true);
+        built = true;
+    }
+    return texture;
+}
+
+void LightMap::setBufferScale(float scale) {
+    bufferScale = std::clamp(scale, 0.05f, 1.0f);
+}
+
+void LightMap::addLight(const sf::Vector2f& position, float radius, const sf::Color& color, float intensity) {
+    if (radius <= 0.f || intensity <= 0.f) return;
+    lights.push_back({ position, radius, color, intensity });
+}
+
+bool LightMap::ensureBuffer(const sf::Vector2u& size) {
+    if (size == bufferSize) return true;
+    if (!createBuffer(buffer, size.x, size.y)) {
+        std::cerr << "LightMap: failed to create " << size.x << "x" << size.y << " light buffer" << std::endl;
+        bufferSize = sf::Vector2u(0, 0);
+        return false;
+    }
+    buffer.setSmooth(true);
+    bufferSize = size;
+    return true;
+}
+
+void LightMap::apply(sf::RenderTarget& target) {
+    lastLightCount = 0;
+    lastDropped = 0;
+    bool neutralAmbient = ambient.r == 128 && ambient.g == 128 && ambient.b == 128;
+    if (neutralAmbient && lights.empty()) return;
+
+    // Keep the brightest lights when over budget
+    if (maxLights >= 0 && static_cast<int>(lights.size()) > maxLights) {
+        std::nth_element(lights.begin(), lights.begin() + maxLights, lights.end(),
+                         [](const Light& a, const Light& b) { return a.intensity > b.intensity; });
+        lastDropped = static_cast<int>(lights.size()) - maxLights;
+        lights.resize(static_cast<std::size_t>(maxLights));
+    }
+
+    // The buffer is sized from the whole target and only the part under the view's
+    // viewport is used, so a dynamic world scale doesn't reallocate it
+    sf::Vector2u ts = target.getSize();
+    sf::Vector2u size(std::max(1u, static_cast<unsigned int>(ts.x * bufferScale)),
+                      std::max(1u, static_cast<unsigned int>(ts.y * bufferScale)));
+    if (!ensureBuffer(size)) { lights.clear(); return; }
+
+    const sf::View& worldView = target.getView();
+    const sf::FloatRect& vp = worldView.getViewport();
+    sf::View lightView = worldView;
+    lightView.setViewport(sf::FloatRect(0.f, 0.f, vp.width, vp.height));
+    buffer.setView(lightView);
+    buffer.clear(ambient);
+
+    {
+        RenderStats::Scope statsScope(RenderStats::Subsystem::LIGHTS);
+        const sf::Texture& falloff = falloffTexture();
+        sf::Vector2f fs(static_cast<float>(falloff.getSize().x), static_cast<float>(falloff.getSize().y));
+        sf::FloatRect visible = viewCullRect(target, 0.0f);
+        quads.clear();
+        for (const Light& l : lights) {
+            float r = l.radius * radiusScale;
+            sf::FloatRect bounds(l.position.x - r, l.position.y - r, r * 2.f, r * 2.f);
+            if (!bounds.intersects(visible)) continue;
+            sf::Color c(static_cast<sf::Uint8>(std::min(255.f, l.color.r * l.intensity)),
+                        static_cast<sf::Uint8>(std::min(255.f, l.color.g * l.intensity)),
+                        static_cast<sf::Uint8>(std::min(255.f, l.color.b * l.intensity)));
+            appendQuad(quads, bounds, sf::FloatRect(0.f, 0.f, fs.x, fs.y), c);
+            ++lastLightCount;
+        }
+        RenderStats::draw(buffer, quads, sf::RenderStates(sf::BlendAdd, sf::Transform::Identity, &falloff, nullptr));
+        buffer.display();
+
+        // Stretch the used corner of the buffer over the visible world
+        sf::Vector2f used(bufferSize.x * vp.width, bufferSize.y * vp.height);
+        quads.clear();
+        appendQuad(quads, visible, sf::FloatRect(0.f, 0.f, used.x, used.y), sf::Color::White);
+        RenderStats::draw(target, quads, sf::RenderStates(kModulate2x, sf::Transform::Identity, &buffer.getTexture(), nullptr));
+        quads.clear();
+    }
+    lights.clear();
+}
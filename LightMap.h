@@ -0,0 +1,57 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+// Low-resolution light accumulation buffer multiplied over the world. The buffer is
+// cleared to the ambient colour, radial light quads are added on top, and the result is
+// composited with a 2x modulate blend: mid grey (128) leaves the world unchanged, darker
+// values dim it and lights above mid grey brighten it. Frames with neutral ambient and no
+// lights skip the pass entirely.
+class LightMap {
+public:
+    // Ambient in 2x-modulate space (128,128,128 = unlit world unchanged)
+    void setAmbient(const sf::Color& color) { ambient = color; }
+    const sf::Color& getAmbient() const { return ambient; }
+    // Fraction of the target resolution the buffer is rendered at (clamped to 0.05..1)
+    void setBufferScale(float scale);
+    // Lights beyond this many per frame are dropped, dimmest first
+    void setMaxLights(int count) { maxLights = count; }
+    // Multiplies every light's radius (cheap way to trade reach for fill rate)
+    void setRadiusScale(float scale) { radiusScale = scale; }
+
+    // Queue a light for this frame. color is what the light adds at its centre (in the
+    // same 2x space, so 128 doubles the world's brightness there); intensity scales it.
+    void addLight(const sf::Vector2f& position, float radius, const sf::Color& color, float intensity = 1.0f);
+
+    // Accumulate the frame's lights and multiply them over what the target holds under its
+    // current view. Clears the light list.
+    void apply(sf::RenderTarget& target);
+
+    int getLastLightCount() const { return lastLightCount; }
+    int getDroppedLightCount() const { return lastDropped; }
+
+private:
+    struct Light {
+        sf::Vector2f position;
+        float radius;
+        sf::Color color;
+        float intensity;
+    };
+
+    bool ensureBuffer(const sf::Vector2u& size);
+    static const sf::Texture& falloffTexture();
+
+    std::vector<Light> lights;
+    sf::VertexArray quads{ sf::Triangles };
+    sf::RenderTexture buffer;
+    sf::Vector2u bufferSize{ 0, 0 };
+
+    sf::Color ambient{ 128, 128, 128 };
+    float bufferScale = 0.25f;
+    int maxLights = 32;
+    float radiusScale = 1.0f;
+
+    int lastLightCount = 0;
+    int lastDropped = 0;
+};
@@ -0,0 +1,99 @@
+#include "ParticleBudget.hpp"
+#include "ParticleSystem.hpp"
+#include <algorithm>
+#include <cmath>
+
+ParticleBudget::Spawn ParticleBudget::_frameSpawns[ParticleBudget::kMaxFrameSpawns];
+int ParticleBudget::_frameSpawnCount = 0;
+sf::Vector2f ParticleBudget::_cameraCenter(0.f, 0.f);
+sf::Vector2f ParticleBudget::_cameraHalfSize(0.f, 0.f);
+size_t ParticleBudget::_maxLive = 40000;
+float ParticleBudget::_frameBudgetMs = 0.0f;
+float ParticleBudget::_mergeRadius = 24.0f;
+float ParticleBudget::_smoothedFrameMs = 0.0f;
+ParticleBudget::Stats ParticleBudget::_stats;
+
+namespace {
+    // Effects past the view edge keep this fraction of their particles (mostly for ground stains)
+    const float kOffscreenScale = 0.3f;
+    // Live-particle load above which everything starts shrinking, and the floor it shrinks to
+    const float kLoadSoftLimit = 0.5f;
+    const float kLoadMinScale = 0.2f;
+    // Low-priority effects are skipped past these
+    const float kLowPriorityLoad = 0.75f;
+    const float kLowPriorityPressure = 1.25f;
+    // Kill bursts never shrink below this
+    const float kHighPriorityMinScale = 0.5f;
+}
+
+void ParticleBudget::beginFrame(const sf::View& camera) {
+    _frameSpawnCount = 0;
+    _cameraCenter = camera.getCenter();
+    _cameraHalfSize = camera.getSize() * 0.5f;
+}
+
+void ParticleBudget::setFrameTime(float workMs) {
+    // Short moving average so a single hitch doesn't thin out the next fight
+    if (_smoothedFrameMs <= 0.0f) _smoothedFrameMs = workMs;
+    else _smoothedFrameMs += (workMs - _smoothedFrameMs) * 0.2f;
+}
+
+size_t ParticleBudget::request(const sf::Vector2f& pos, size_t count, Priority priority) {
+    if (count == 0) return 0;
+    ++_stats.requested;
+
+    // A same-priority effect already spawned here this frame covers this one. Kill bursts
+    // are layered on purpose (getBig + getBigFast), so they are never treated as duplicates.
+    const float mergeSq = _mergeRadius * _mergeRadius;
+    for (int i = 0; priority != Priority::HIGH && i < _frameSpawnCount; ++i) {
+        const Spawn& s = _frameSpawns[i];
+        float dx = s.position.x - pos.x;
+        float dy = s.position.y - pos.y;
+        if (dx * dx + dy * dy <= mergeSq && s.priority == priority) {
+            ++_stats.dropped;
+            return 0;
+        }
+    }
+
+    const size_t live = Props::ParticleSystem::getLiveCount();
+    const float load = _maxLive > 0 ? static_cast<float>(live) / static_cast<float>(_maxLive) : 1.0f;
+    const float pressure = _frameBudgetMs > 0.0f ? _smoothedFrameMs / _frameBudgetMs : 0.0f;
+
+    // 0 at the camera centre, 1 at the view edge, above 1 off screen
+    float edge = 0.0f;
+    if (_cameraHalfSize.x > 0.0f && _cameraHalfSize.y > 0.0f) {
+        edge = std::max(std::abs(pos.x - _cameraCenter.x) / _cameraHalfSize.x,
+                        std::abs(pos.y - _cameraCenter.y) / _cameraHalfSize.y);
+    }
+
+    if (priority == Priority::LOW && (edge > 1.0f || load > kLowPriorityLoad || pressure > kLowPriorityPressure)) {
+        ++_stats.dropped;
+        return 0;
+    }
+
+    float scale = edge > 1.0f ? kOffscreenScale : 1.0f - 0.3f * edge;
+    if (load > kLoadSoftLimit) {
+        float t = (load - kLoadSoftLimit) / (1.0f - kLoadSoftLimit);
+        scale *= std::max(kLoadMinScale, 1.0f - t * (1.0f - kLoadMinScale));
+    }
+    if (pressure > 1.0f) scale /= pressure;
+    if (priority == Priority::HIGH) scale = std::max(scale, kHighPriorityMinScale);
+
+    size_t granted = std::max<size_t>(1, static_cast<size_t>(std::lround(count * std::min(scale, 1.0f))));
+    // Hard cap: only kill bursts may take whatever room is left
+    const size_t room = live < _maxLive ? _maxLive - live : 0;
+    if (granted > room) {
+        if (priority != Priority::HIGH || room == 0) {
+            ++_stats.dropped;
+            return 0;
+        }
+        granted = room;
+    }
+    return granted;
+}
+
+void ParticleBudget::commit(const sf::Vector2f& pos, size_t count, size_t granted, Priority priority) {
+    if (granted < count) ++_stats.scaled;
+    ++_stats.spawned;
+    if (_frameSpawnCount < kMaxFrameSpawns) _frameSpawns[_frameSpawnCount++] = { pos, priority };
+}
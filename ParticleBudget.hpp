@@ -0,0 +1,60 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+
+// Decides how much of each requested effect actually gets spawned. ExplosionProvider asks
+// before every explosion; the answer shrinks with the live particle count, the recent frame
+// work time and the distance from the camera, low-priority effects are dropped first, and
+// effects landing on top of a same-priority one spawned this frame are dropped as duplicates.
+// The live particle cap is a hard limit, so effect cost stays bounded at the worst moments.
+class ParticleBudget {
+public:
+    enum class Priority { LOW, NORMAL, HIGH };
+
+    struct Stats {
+        int requested = 0;
+        int spawned = 0;
+        int scaled = 0;  // spawned with fewer particles than asked
+        int dropped = 0; // over budget, duplicate of a same-frame effect, or no pool slot
+    };
+
+    static void setMaxLiveParticles(size_t count) { _maxLive = count; }
+    // Frame work time above which effects start shrinking (0 disables the frame-time term)
+    static void setFrameBudgetMs(float ms) { _frameBudgetMs = ms; }
+    static void setMergeRadius(float radius) { _mergeRadius = radius; }
+
+    // Start a frame: forget last frame's spawns and take the camera for distance LOD
+    static void beginFrame(const sf::View& camera);
+    // Feed the measured frame work time (smoothed internally)
+    static void setFrameTime(float workMs);
+
+    // Particle count to spawn for an effect asking for 'count' at 'pos'. 0 means the effect
+    // was dropped and should not be spawned. A granted effect must be reported back with
+    // commit() once it exists, or reject() if it could not be created.
+    static size_t request(const sf::Vector2f& pos, size_t count, Priority priority);
+    // The granted effect was spawned: count it and remember it for duplicate checks
+    static void commit(const sf::Vector2f& pos, size_t count, size_t granted, Priority priority);
+    // The granted effect could not be spawned after all
+    static void reject() { ++_stats.dropped; }
+
+    static const Stats& getStats() { return _stats; }
+    static void resetStats() { _stats = Stats(); }
+
+private:
+    struct Spawn {
+        sf::Vector2f position;
+        Priority priority;
+    };
+    static const int kMaxFrameSpawns = 64;
+
+    static Spawn _frameSpawns[kMaxFrameSpawns];
+    static int _frameSpawnCount;
+    static sf::Vector2f _cameraCenter;
+    static sf::Vector2f _cameraHalfSize;
+
+    static size_t _maxLive;
+    static float _frameBudgetMs;
+    static float _mergeRadius;
+    static float _smoothedFrameMs;
+    static Stats _stats;
+};
@@ -0,0 +1,154 @@
+#include "ParticleSystem.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PARTICLES_SSE2 1
+#endif
+
+using namespace Props;
+
+std::vector<float> ParticleSystem::x;
+std::vector<float> ParticleSystem::y;
+std::vector<float> ParticleSystem::prevX;
+std::vector<float> ParticleSystem::prevY;
+std::vector<float> ParticleSystem::vx;
+std::vector<float> ParticleSystem::vy;
+std::vector<float> ParticleSystem::dirX;
+std::vector<float> ParticleSystem::dirY;
+std::vector<float> ParticleSystem::size;
+std::vector<sf::Color> ParticleSystem::color;
+size_t ParticleSystem::_count = 0;
+uint32_t ParticleSystem::_tick = 0;
+// Reduced jitter (was large) - keeps particles near their computed trajectory.
+float ParticleSystem::_jitter = 0.6f;
+
+namespace {
+    // Room for a heavy fight up front so the arrays don't reallocate mid-burst
+    const size_t kInitialCapacity = 65536;
+
+    // Tick rate the jitter amplitude is tuned at (the rate effects were written for)
+    const float kJitterTuningRate = 120.0f;
+
+    // One round of mixing for the per-tick seeds
+    uint32_t mix32(uint32_t h) {
+        h ^= h >> 16; h *= 0x7feb352dU;
+        h ^= h >> 15; h *= 0x846ca68bU;
+        h ^= h >> 16;
+        return h;
+    }
+
+    // xorshift32 applied twice to (index ^ seed); only shifts and xors, so it vectorizes on SSE2
+    inline uint32_t xorshift2(uint32_t v) {
+        v ^= v << 13; v ^= v >> 17; v ^= v << 5;
+        v ^= v << 13; v ^= v >> 17; v ^= v << 5;
+        return v;
+    }
+
+    // Top 23 bits as a float in [-0.5, 0.5)
+    inline float toSigned(uint32_t v) {
+        uint32_t bits = (v >> 9) | 0x3F800000U;
+        float f;
+        std::memcpy(&f, &bits, sizeof(f));
+        return f - 1.5f;
+    }
+
+    template <typename T>
+    void moveRange(std::vector<T>& v, size_t from, size_t to, size_t n) {
+        std::memmove(v.data() + to, v.data() + from, n * sizeof(T));
+    }
+}
+
+size_t ParticleSystem::allocate(size_t n) {
+    if (x.capacity() < kInitialCapacity) {
+        x.reserve(kInitialCapacity); y.reserve(kInitialCapacity);
+        prevX.reserve(kInitialCapacity); prevY.reserve(kInitialCapacity);
+        vx.reserve(kInitialCapacity); vy.reserve(kInitialCapacity);
+        dirX.reserve(kInitialCapacity); dirY.reserve(kInitialCapacity);
+        size.reserve(kInitialCapacity); color.reserve(kInitialCapacity);
+    }
+    size_t first = _count;
+    _count += n;
+    x.resize(_count); y.resize(_count);
+    prevX.resize(_count); prevY.resize(_count);
+    vx.resize(_count); vy.resize(_count);
+    dirX.resize(_count); dirY.resize(_count);
+    size.resize(_count); color.resize(_count);
+    return first;
+}
+
+void ParticleSystem::move(size_t from, size_t to, size_t n) {
+    if (from == to || n == 0) return;
+    moveRange(x, from, to, n); moveRange(y, from, to, n);
+    moveRange(prevX, from, to, n); moveRange(prevY, from, to, n);
+    moveRange(vx, from, to, n); moveRange(vy, from, to, n);
+    moveRange(dirX, from, to, n); moveRange(dirY, from, to, n);
+    moveRange(size, from, to, n); moveRange(color, from, to, n);
+}
+
+void ParticleSystem::truncate(size_t n) {
+    if (n >= _count) return;
+    _count = n;
+    x.resize(n); y.resize(n);
+    prevX.resize(n); prevY.resize(n);
+    vx.resize(n); vy.resize(n);
+    dirX.resize(n); dirY.resize(n);
+    size.resize(n); color.resize(n);
+}
+
+uint32_t ParticleSystem::random(uint32_t index) {
+    return xorshift2((index + 1U) ^ mix32(_tick * 0x9E3779B9U + 0x632BE5ABU));
+}
+
+void ParticleSystem::step(float dt) {
+    ++_tick;
+    std::memcpy(prevX.data(), x.data(), _count * sizeof(float));
+    std::memcpy(prevY.data(), y.data(), _count * sizeof(float));
+    // Two independent streams (x and y jitter) keyed by particle index
+    const uint32_t seedX = mix32(_tick * 2U);
+    const uint32_t seedY = mix32(_tick * 2U + 1U);
+    // Jitter is a random walk: its spread grows with the square root of elapsed time,
+    // so a tick of dt gets sqrt(dt / tuning tick) times the tuned per-tick amplitude.
+    const float amp = _jitter * std::sqrt(dt * kJitterTuningRate);
+    const float step = dt;
+    float* px = x.data();
+    float* py = y.data();
+    const float* pvx = vx.data();
+    const float* pvy = vy.data();
+    const size_t n = _count;
+    size_t i = 0;
+
+#if defined(PARTICLES_SSE2)
+    const __m128i lane = _mm_set_epi32(4, 3, 2, 1);
+    const __m128i sx = _mm_set1_epi32(static_cast<int>(seedX));
+    const __m128i sy = _mm_set1_epi32(static_cast<int>(seedY));
+    const __m128i one = _mm_set1_epi32(0x3F800000);
+    const __m128 bias = _mm_set1_ps(1.5f);
+    const __m128 vamp = _mm_set1_ps(amp);
+    const __m128 vdt = _mm_set1_ps(step);
+    for (; i + 4 <= n; i += 4) {
+        __m128i idx = _mm_add_epi32(_mm_set1_epi32(static_cast<int>(i)), lane);
+        __m128i hx = _mm_xor_si128(idx, sx);
+        __m128i hy = _mm_xor_si128(idx, sy);
+        for (int r = 0; r < 2; ++r) {
+            hx = _mm_xor_si128(hx, _mm_slli_epi32(hx, 13)); hy = _mm_xor_si128(hy, _mm_slli_epi32(hy, 13));
+            hx = _mm_xor_si128(hx, _mm_srli_epi32(hx, 17)); hy = _mm_xor_si128(hy, _mm_srli_epi32(hy, 17));
+            hx = _mm_xor_si128(hx, _mm_slli_epi32(hx, 5));  hy = _mm_xor_si128(hy, _mm_slli_epi32(hy, 5));
+        }
+        __m128 jx = _mm_sub_ps(_mm_castsi128_ps(_mm_or_si128(_mm_srli_epi32(hx, 9), one)), bias);
+        __m128 jy = _mm_sub_ps(_mm_castsi128_ps(_mm_or_si128(_mm_srli_epi32(hy, 9), one)), bias);
+        __m128 nx = _mm_add_ps(_mm_add_ps(_mm_loadu_ps(px + i), _mm_mul_ps(_mm_loadu_ps(pvx + i), vdt)), _mm_mul_ps(jx, vamp));
+        __m128 ny = _mm_add_ps(_mm_add_ps(_mm_loadu_ps(py + i), _mm_mul_ps(_mm_loadu_ps(pvy + i), vdt)), _mm_mul_ps(jy, vamp));
+        _mm_storeu_ps(px + i, nx);
+        _mm_storeu_ps(py + i, ny);
+    }
+#endif
+
+    for (; i < n; ++i) {
+        uint32_t idx = static_cast<uint32_t>(i) + 1U;
+        px[i] += pvx[i] * step + toSigned(xorshift2(idx ^ seedX)) * amp;
+        py[i] += pvy[i] * step + toSigned(xorshift2(idx ^ seedY)) * amp;
+    }
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace Props {
+
+    // Every explosion particle in the game, stored structure-of-arrays. Each Explosion owns
+    // one contiguous slice [first, first + n); slices stay in creation order so dead ones can
+    // be squeezed out with a single stable compaction pass per tick. The motion step runs
+    // four particles at a time with SSE2 and draws its jitter from a counter-based hash
+    // instead of rand(), so the tick cost is a flat pass over the arrays. Velocities are in
+    // pixels per second and the previous position is kept so renders can interpolate.
+    class ParticleSystem
+    {
+    public:
+        // Hot arrays (touched by step) and cold per-particle attributes (read when rendering)
+        static std::vector<float> x, y;
+        static std::vector<float> prevX, prevY; // positions before the last step
+        static std::vector<float> vx, vy;       // pixels per second
+        static std::vector<float> dirX, dirY; // precomputed unit direction used by untextured chips
+        static std::vector<float> size;
+        static std::vector<sf::Color> color;
+
+        // Reserve n particles at the end of the arrays, returns the index of the first one
+        static size_t allocate(size_t n);
+        // Move [from, from + n) down to 'to' (to <= from), used by the owner's compaction pass
+        static void move(size_t from, size_t to, size_t n);
+        // Drop everything past the first n particles (keeps capacity)
+        static void truncate(size_t n);
+        static void clear() { truncate(0); }
+
+        // Advance every particle by dt seconds: prev = p, p += v * dt + jitter
+        static void step(float dt);
+
+        // Cheap deterministic hash of (index, tick) for per-particle randomness
+        static uint32_t random(uint32_t index);
+
+        static size_t getLiveCount() { return _count; }
+        static size_t getCapacity() { return x.capacity(); }
+        // Peak random offset in pixels per 1/120 s tick; longer ticks scale it by sqrt(dt * 120)
+        static void setJitter(float amplitude) { _jitter = amplitude; }
+
+    private:
+        static size_t _count;
+        static uint32_t _tick;
+        static float _jitter;
+    };
+
+} // namespace Props
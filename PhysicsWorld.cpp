@@ -19,6 +19,7 @@ void PhysicsWorld::addBody(PhysicsBody* body, bool isStatic) {
         return;
     }
     vec.push_back(body);
+    if (isStatic) ++staticGeneration;
 }
 
 void PhysicsWorld::removeBody(PhysicsBody* body) {
@@ -34,6 +35,7 @@ void PhysicsWorld::removeBody(PhysicsBody* body) {
     auto it_static = std::remove(staticBodies.begin(), staticBodies.end(), body);
     if (it_static != staticBodies.end()) {
         staticBodies.erase(it_static, staticBodies.end());
+        ++staticGeneration;
         return;
     }
 }
@@ -59,6 +61,7 @@ void PhysicsWorld::update(float dt) {
     auto its = std::remove_if(staticBodies.begin(), staticBodies.end(), deadPredicate);
     if (its != staticBodies.end()) staticBodies.erase(its, staticBodies.end());
     size_t removedStatic = beforeStatic - staticBodies.size();
+    if (removedStatic > 0) ++staticGeneration;
 
     if (debugLogging) {
         g_debugLogTimer += dt;
@@ -17,6 +17,10 @@ public:
     void setDebugLogging(bool enabled) { debugLogging = enabled; }
     int getDynamicBodyCount() const { return static_cast<int>(dynamicBodies.size()); }
     int getStaticBodyCount() const { return static_cast<int>(staticBodies.size()); }
+    // Bumped whenever the static set changes; code that moves or resizes a static body in
+    // place must call notifyStaticBodyMoved() so cached obstacle data (FlowField) refreshes
+    unsigned int getStaticGeneration() const { return staticGeneration; }
+    void notifyStaticBodyMoved() { ++staticGeneration; }
     int getLastCollisionChecks() const { return lastCollisionChecks; }
 
 private:
@@ -32,4 +36,5 @@ private:
     // Debugging fields
     bool debugLogging = false;
     int lastCollisionChecks = 0;
+    unsigned int staticGeneration = 0;
 };
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "Player.h"
 #include "Bullet.h"
+#include "RenderStats.h"
+#include "LightMap.h"
 #include <iostream>
 #include <cmath>
 #include <algorithm>
@@ -701,6 +703,13 @@ void Player::shoot(const sf::Vector2f& target, PhysicsWorld& physicsWorld, std::
     }
 }
 
+void Player::submitLights(LightMap& lights) const {
+    for (const auto& mf : activeMuzzles) {
+        float t = mf.maxLife > 0.0f ? mf.life / mf.maxLife : 0.0f;
+        lights.addLight(mf.sprite.getPosition(), muzzleLightRadius, muzzleLightColor, t);
+    }
+}
+
 void Player::startReload() {
     if (reloading) return;
     if (currentWeapon != WeaponType::PISTOL && currentWeapon != WeaponType::RIFLE) return;
@@ -884,7 +893,7 @@ void Player::applyKnockback(const sf::Vector2f& direction, float force) {
     knockbackTimer = knockbackDuration;
 }
 
-void Player::draw(sf::RenderWindow& window) {
+void Player::draw(sf::RenderTarget& window) {
     // For compatibility: draw is same as render here
     render(window);
 }
@@ -956,7 +965,8 @@ void Player::setWeapon(WeaponType weapon) {
     }
 }
 
-void Player::render(sf::RenderWindow& window) {
+void Player::render(sf::RenderTarget& window) {
+    RenderStats::Scope statsScope(RenderStats::Subsystem::PLAYER);
     // If the entity was destroyed (owner cleared), skip rendering completely
     if (!isAlive()) return;
     // interpolate position
@@ -965,8 +975,8 @@ void Player::render(sf::RenderWindow& window) {
     feetSprite.setPosition(interp.x + feetOffsetX, interp.y + feetOffsetY);
 
     // draw feet first so torso renders over them
-    window.draw(feetSprite);
-    window.draw(sprite);
+    RenderStats::draw(window, feetSprite);
+    RenderStats::draw(window, sprite);
 
     // Draw muzzle flashes (use additive blending)
     if (!activeMuzzles.empty()) {
@@ -976,7 +986,7 @@ void Player::render(sf::RenderWindow& window) {
             float t = it->life / it->maxLife;
             sf::Color c = sf::Color(255, 255, 255, static_cast<sf::Uint8>(255 * t));
             it->sprite.setColor(c);
-            window.draw(it->sprite, rs);
+            RenderStats::draw(window, it->sprite, rs);
             // decay (we now decrement in update(), keep this as a safer fallback but much smaller)
             it->life -= 1.0f/60.0f;
             if (it->life <= 0.0f) it = activeMuzzles.erase(it);
@@ -995,7 +1005,7 @@ void Player::render(sf::RenderWindow& window) {
         sh.setScale(shadowScale, shadowScale);
         // DARKER SHADOW: increased alpha for a stronger, darker shadow
         sh.setColor(sf::Color(0,0,0,220));
-        window.draw(sh);
+        RenderStats::draw(window, sh);
     }
 
     if (debugDrawOrigins) {
@@ -1003,20 +1013,20 @@ void Player::render(sf::RenderWindow& window) {
         upperMarker.setFillColor(sf::Color::Red);
         sf::Vector2f upperPos = sprite.getPosition();
         upperMarker.setPosition(upperPos.x - upperMarker.getRadius(), upperPos.y - upperMarker.getRadius());
-        window.draw(upperMarker);
+        RenderStats::draw(window, upperMarker);
 
         sf::CircleShape feetMarker(4.0f);
         feetMarker.setFillColor(sf::Color::Green);
         sf::Vector2f feetPos = feetSprite.getPosition();
         feetMarker.setPosition(feetPos.x - feetMarker.getRadius(), feetPos.y - feetMarker.getRadius());
-        window.draw(feetMarker);
+        RenderStats::draw(window, feetMarker);
 
         // Draw recent muzzle spawn markers (frame-rate independent decay handled in update)
         for (const auto &m : g_recentMuzzles) {
             sf::CircleShape s(3.0f);
             s.setFillColor(sf::Color(255, 0, 255, 200));
             s.setPosition(m.first.x - s.getRadius(), m.first.y - s.getRadius());
-            window.draw(s);
+            RenderStats::draw(window, s);
         }
 
         // Draw debug line projecting out from the muzzle position in the sprite facing direction
@@ -1030,7 +1040,7 @@ void Player::render(sf::RenderWindow& window) {
                 sf::Vertex(muzzlePos, sf::Color(255, 0, 255, 200)),
                 sf::Vertex(sf::Vector2f(muzzlePos.x + dir.x * lineLen, muzzlePos.y + dir.y * lineLen), sf::Color(255, 0, 255, 120))
             };
-            window.draw(line, 2, sf::Lines);
+            RenderStats::draw(window, line, 2, sf::Lines);
         }
 
         // Debug: draw accuracy/spread cone for current weapon (base inaccuracy + recoil)
@@ -1062,7 +1072,7 @@ void Player::render(sf::RenderWindow& window) {
                     sf::Vector2f p(muzzlePos.x + std::cos(ang) * coneLen, muzzlePos.y + std::sin(ang) * coneLen);
                     fan.append(sf::Vertex(p, coneColor));
                 }
-                window.draw(fan);
+                RenderStats::draw(window, fan);
 
                 // boundary lines
                 sf::Color lineC(255, 200, 0, 200);
@@ -1070,8 +1080,8 @@ void Player::render(sf::RenderWindow& window) {
                 sf::Vector2f rightP(muzzlePos.x + std::cos(baseRad + spreadRad) * coneLen, muzzlePos.y + std::sin(baseRad + spreadRad) * coneLen);
                 sf::Vertex bl[2] = { sf::Vertex(muzzlePos, lineC), sf::Vertex(leftP, lineC) };
                 sf::Vertex br[2] = { sf::Vertex(muzzlePos, lineC), sf::Vertex(rightP, lineC) };
-                window.draw(bl, 2, sf::Lines);
-                window.draw(br, 2, sf::Lines);
+                RenderStats::draw(window, bl, 2, sf::Lines);
+                RenderStats::draw(window, br, 2, sf::Lines);
             }
         }
     }
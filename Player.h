@@ -10,6 +10,8 @@
 #include <array>
 #include "include/Animator.h"
 
+class LightMap;
+
 enum class PlayerState {
     IDLE,
     WALK,
@@ -35,8 +37,8 @@ public:
     Player(Vec2 position);
 
     void update(float deltaTime, sf::RenderWindow& window, sf::Vector2u mapSize, sf::Vector2f worldMousePosition);
-    void draw(sf::RenderWindow& window);
-    void render(sf::RenderWindow& window);
+    void draw(sf::RenderTarget& window);
+    void render(sf::RenderTarget& window);
     void attack();
     void takeDamage(float amount);
     void kill();
@@ -193,6 +195,10 @@ public:
     float muzzleFlashRotationOffset = 90.0f;
     // Optional random jitter applied to flash rotation (+/- degrees)
     float muzzleFlashRotationJitterDeg = 0.0f;
+    // Light cast by each active flash (fades with the flash)
+    float muzzleLightRadius = 260.0f;
+    sf::Color muzzleLightColor = sf::Color(255, 190, 110);
+    void submitLights(LightMap& lights) const;
 
 private:
     void loadTextures();
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+// Screen-space effects applied to the world layer before the HUD is drawn.
+// Desaturation and the blood overlay run as one fused shader pass over an offscreen
+// copy of the world, which can also be rendered below native resolution. When every
+// effect is neutral and the scale is 1 (the usual case) begin() hands back the window
+// itself and no offscreen target is touched.
+class PostProcessChain {
+public:
+    // Compile the fused shader. Returns false when shaders are unavailable; the chain
+    // then never goes offscreen and end() falls back to plain overlay draws.
+    bool init();
+
+    // Per-frame parameters
+    void setDesaturation(float amount);                            // 0 = full colour, 1 = grayscale
+    void setBloodOverlay(const sf::Texture* texture, float alpha); // alpha 0..1, texture stretched to the window
+    // Fraction of the window resolution the world is rendered at (clamped to 0.1..1).
+    // Below 1 the world always goes offscreen and is upscaled when composited.
+    void setRenderScale(float scale);
+    float getRenderScale() const { return renderScale; }
+
+    // Target for this frame's world drawing with worldView applied: the window when the
+    // pass would be a no-op, otherwise the cleared scene texture. At reduced scale the view
+    // is squeezed into a corner of the scene, so the texture is only resized with the window.
+    sf::RenderTarget& begin(sf::RenderWindow& window, const sf::View& worldView);
+    // Composite the world onto the window (default view) and apply the blood overlay
+    void end(sf::RenderWindow& window);
+
+    bool isOffscreenActive() const { return offscreenActive; }
+    int getOffscreenFrameCount() const { return offscreenFrames; }
+    void resetStats() { offscreenFrames = 0; }
+
+private:
+    bool needsDesaturation() const { return desaturation > 0.001f; }
+    bool isScaled() const { return renderScale < 0.999f; }
+    bool needsBlood() const { return bloodTexture && bloodAlpha * 255.f >= 1.f; }
+    bool ensureScene(const sf::Vector2u& size);
+    void drawBloodSprite(sf::RenderWindow& window);
+
+    sf::Shader fusedShader;
+    bool shaderReady = false;
+
+    sf::RenderTexture scene;
+    sf::Vector2u sceneSize{ 0, 0 };
+    sf::Vector2i scaledSize{ 0, 0 }; // pixels of the scene actually rendered this frame
+    float renderScale = 1.0f;
+    bool offscreenActive = false;
+    int offscreenFrames = 0;
+
+    float desaturation = 0.f;
+    const sf::Texture* bloodTexture = nullptr;
+    float bloodAlpha = 0.f;
+};
@@ -0,0 +1,136 @@
+#include "RenderQueue.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Key layout, most significant first: layer 4 | depth 16 | order 4 | texture 8
+    const int kDepthShift = 12;
+    const int kOrderShift = 8;
+    const std::uint32_t kLayerShift = 28;
+    const std::uint32_t kMaxDepth = 0xFFFF;
+    // Callbacks and overflowing texture ids sort after the textured quads at their depth
+    const std::uint32_t kNoTextureId = 0xFF;
+}
+
+void RenderQueue::begin(float top, float height) {
+    depthTop = top;
+    depthScale = height > 0.f ? static_cast<float>(kMaxDepth) / height : 0.f;
+    items.clear();
+    vertices.clear();
+    callbacks.clear();
+    entries.clear();
+    textureIds.clear();
+}
+
+std::uint32_t RenderQueue::textureIdFor(const sf::Texture* texture) {
+    for (std::size_t i = 0; i < textureIds.size(); ++i)
+        if (textureIds[i] == texture) return static_cast<std::uint32_t>(i);
+    if (textureIds.size() >= kNoTextureId) return kNoTextureId;
+    textureIds.push_back(texture);
+    return static_cast<std::uint32_t>(textureIds.size() - 1);
+}
+
+std::uint32_t RenderQueue::makeKey(Layer layer, float depth, int order, std::uint32_t textureId) const {
+    float d = std::clamp((depth - depthTop) * depthScale, 0.f, static_cast<float>(kMaxDepth));
+    return (static_cast<std::uint32_t>(layer) << kLayerShift)
+         | (static_cast<std::uint32_t>(d) << kDepthShift)
+         | (static_cast<std::uint32_t>(std::clamp(order, 0, 15)) << kOrderShift)
+         | textureId;
+}
+
+void RenderQueue::submit(Layer layer, float depth, int order, const sf::Texture& texture, const sf::IntRect& rect,
+                         const sf::Transform& transform, const sf::Color& color, const sf::BlendMode& blend) {
+    Item item;
+    item.texture = &texture;
+    item.blend = blend;
+    item.subsystem = RenderStats::getCurrentSubsystem();
+    item.firstVertex = vertices.size();
+
+    // Same local geometry sf::Sprite uses (see SpriteBatch::draw)
+    float w = static_cast<float>(std::abs(rect.width));
+    float h = static_cast<float>(std::abs(rect.height));
+    float left = static_cast<float>(rect.left);
+    float right = left + static_cast<float>(rect.width);
+    float top = static_cast<float>(rect.top);
+    float bottom = top + static_cast<float>(rect.height);
+    sf::Vertex v0(transform.transformPoint(0.f, 0.f), color, sf::Vector2f(left, top));
+    sf::Vertex v1(transform.transformPoint(w, 0.f), color, sf::Vector2f(right, top));
+    sf::Vertex v2(transform.transformPoint(w, h), color, sf::Vector2f(right, bottom));
+    sf::Vertex v3(transform.transformPoint(0.f, h), color, sf::Vector2f(left, bottom));
+    vertices.push_back(v0); vertices.push_back(v1); vertices.push_back(v2);
+    vertices.push_back(v0); vertices.push_back(v2); vertices.push_back(v3);
+
+    entries.push_back({ makeKey(layer, depth, order, textureIdFor(&texture)), static_cast<std::uint32_t>(items.size()) });
+    items.push_back(item);
+}
+
+void RenderQueue::submit(Layer layer, float depth, int order, Callback callback) {
+    Item item;
+    item.subsystem = RenderStats::getCurrentSubsystem();
+    item.callback = static_cast<int>(callbacks.size());
+    callbacks.push_back(std::move(callback));
+    entries.push_back({ makeKey(layer, depth, order, kNoTextureId), static_cast<std::uint32_t>(items.size()) });
+    items.push_back(item);
+}
+
+void RenderQueue::sortEntries() {
+    // LSD radix sort, one byte per pass. Stable, so equal keys keep submission order.
+    // Passes where every key has the same byte are skipped (the layer byte usually is).
+    scratch.resize(entries.size());
+    for (int shift = 0; shift < 32; shift += 8) {
+        std::size_t counts[256] = {};
+        for (const SortEntry& e : entries) ++counts[(e.key >> shift) & 0xFF];
+        if (counts[(entries[0].key >> shift) & 0xFF] == entries.size()) continue;
+
+        std::size_t offset = 0;
+        for (std::size_t& c : counts) {
+            std::size_t n = c;
+            c = offset;
+            offset += n;
+        }
+        for (const SortEntry& e : entries) scratch[counts[(e.key >> shift) & 0xFF]++] = e;
+        entries.swap(scratch);
+    }
+}
+
+void RenderQueue::drawBatch(sf::RenderTarget& target) {
+    if (batch.getVertexCount() == 0) return;
+    RenderStats::Scope statsScope(batchSubsystem);
+    sf::RenderStates states(batchBlend);
+    states.texture = batchTexture;
+    RenderStats::draw(target, batch, states);
+    batch.clear();
+    ++lastDrawCalls;
+}
+
+void RenderQueue::flush(sf::RenderTarget& target) {
+    lastItemCount = static_cast<int>(entries.size());
+    lastDrawCalls = 0;
+    if (entries.empty()) return;
+    sortEntries();
+
+    for (const SortEntry& e : entries) {
+        const Item& item = items[e.item];
+        if (item.callback >= 0) {
+            drawBatch(target);
+            RenderStats::Scope statsScope(item.subsystem);
+            callbacks[item.callback](target);
+            ++lastDrawCalls;
+            continue;
+        }
+        if (batch.getVertexCount() > 0 &&
+            (item.texture != batchTexture || !(item.blend == batchBlend) || item.subsystem != batchSubsystem))
+            drawBatch(target);
+        batchTexture = item.texture;
+        batchBlend = item.blend;
+        batchSubsystem = item.subsystem;
+        for (std::size_t i = 0; i < 6; ++i) batch.append(vertices[item.firstVertex + i]);
+    }
+    drawBatch(target);
+
+    items.clear();
+    vertices.clear();
+    callbacks.clear();
+    entries.clear();
+    textureIds.clear();
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "RenderStats.h"
+
+// Per-frame draw list for world entities. Items carry a layer, a depth (world y of the
+// point where the item touches the ground) and a texture. flush() radix-sorts them once
+// by (layer, depth, order, texture) so entities lower on screen overlap the ones above
+// them, and consecutive quads sharing a texture and blend mode go out as one draw.
+// Callback items let entities that draw themselves (the player) join the ordering.
+class RenderQueue {
+public:
+    enum class Layer : std::uint8_t {
+        SHADOWS = 0,  // under every entity; submit at depth 0 so they batch by texture alone
+        ENTITIES = 1  // y-sorted bodies
+    };
+    typedef std::function<void(sf::RenderTarget&)> Callback;
+
+    // Start a frame. Depths are quantized over [depthTop, depthTop + depthHeight); pass the
+    // culled view rect so the 16-bit depth keeps sub-pixel precision.
+    void begin(float depthTop, float depthHeight);
+
+    // Queue a sprite-like quad. order (0..15) breaks ties at equal depth, e.g. body 0, hit flash 1.
+    void submit(Layer layer, float depth, int order, const sf::Texture& texture, const sf::IntRect& rect,
+                const sf::Transform& transform, const sf::Color& color, const sf::BlendMode& blend = sf::BlendAlpha);
+    // Queue a callback that draws directly to the target at its place in the order
+    void submit(Layer layer, float depth, int order, Callback callback);
+
+    // Sort, draw and clear (allocations are kept for the next frame)
+    void flush(sf::RenderTarget& target);
+
+    int getLastItemCount() const { return lastItemCount; }
+    int getLastDrawCalls() const { return lastDrawCalls; }
+
+private:
+    struct Item {
+        const sf::Texture* texture = nullptr;
+        sf::BlendMode blend;
+        RenderStats::Subsystem subsystem = RenderStats::Subsystem::OTHER;
+        std::size_t firstVertex = 0; // quads: 6 vertices in `vertices`
+        int callback = -1;           // callbacks: index into `callbacks`
+    };
+    struct SortEntry {
+        std::uint32_t key;
+        std::uint32_t item;
+    };
+
+    std::uint32_t makeKey(Layer layer, float depth, int order, std::uint32_t textureId) const;
+    std::uint32_t textureIdFor(const sf::Texture* texture);
+    void sortEntries();
+    void drawBatch(sf::RenderTarget& target);
+
+    std::vector<Item> items;
+    std::vector<sf::Vertex> vertices;
+    std::vector<Callback> callbacks;
+    std::vector<SortEntry> entries;
+    std::vector<SortEntry> scratch;
+    // Per-frame texture ids in first-submitted order (the low byte of the key)
+    std::vector<const sf::Texture*> textureIds;
+
+    // Run of sorted quads waiting to be drawn
+    sf::VertexArray batch{ sf::Triangles };
+    const sf::Texture* batchTexture = nullptr;
+    sf::BlendMode batchBlend;
+    RenderStats::Subsystem batchSubsystem = RenderStats::Subsystem::OTHER;
+
+    float depthTop = 0.f;
+    float depthScale = 0.f;
+    int lastItemCount = 0;
+    int lastDrawCalls = 0;
+};
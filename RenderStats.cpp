@@ -0,0 +1,131 @@
+#include "RenderStats.h"
+
+RenderStats::Subsystem RenderStats::current = RenderStats::Subsystem::OTHER;
+RenderStats::Counters RenderStats::frame[RenderStats::kCount];
+RenderStats::Counters RenderStats::lastFrame[RenderStats::kCount];
+RenderStats::Counters RenderStats::window[RenderStats::kCount];
+int RenderStats::windowFrames = 0;
+const sf::RenderTarget* RenderStats::lastTarget = nullptr;
+const sf::Texture* RenderStats::lastTexture = nullptr;
+const sf::Shader* RenderStats::lastShader = nullptr;
+
+RenderStats::Counters& RenderStats::Counters::operator+=(const Counters& o) {
+    drawCalls += o.drawCalls;
+    vertices += o.vertices;
+    textureSwitches += o.textureSwitches;
+    shaderSwitches += o.shaderSwitches;
+    targetSwitches += o.targetSwitches;
+    return *this;
+}
+
+void RenderStats::record(const sf::RenderTarget& target, const sf::Texture* texture, const sf::Shader* shader, int vertices, int calls) {
+    Counters& c = frame[static_cast<int>(current)];
+    c.drawCalls += calls;
+    c.vertices += vertices;
+    if (&target != lastTarget) {
+        // SFML re-applies all states after a target change, so only the target switch counts
+        ++c.targetSwitches;
+        lastTarget = &target;
+        lastTexture = texture;
+        lastShader = shader;
+        return;
+    }
+    if (texture != lastTexture) { ++c.textureSwitches; lastTexture = texture; }
+    if (shader != lastShader) { ++c.shaderSwitches; lastShader = shader; }
+}
+
+void RenderStats::draw(sf::RenderTarget& target, const sf::Sprite& sprite, const sf::RenderStates& states) {
+    record(target, sprite.getTexture(), states.shader, 4, 1);
+    target.draw(sprite, states);
+}
+
+void RenderStats::draw(sf::RenderTarget& target, const sf::Text& text, const sf::RenderStates& states) {
+    // Six vertices per visible glyph, drawn again for the outline
+    int glyphs = 0;
+    const sf::String& str = text.getString();
+    for (std::size_t i = 0; i < str.getSize(); ++i)
+        if (str[i] != ' ' && str[i] != '\t' && str[i] != '\n') ++glyphs;
+    bool outlined = text.getOutlineThickness() != 0.f;
+    const sf::Texture* page = text.getFont() ? &text.getFont()->getTexture(text.getCharacterSize()) : nullptr;
+    record(target, page, states.shader, glyphs * 6 * (outlined ? 2 : 1), outlined ? 2 : 1);
+    target.draw(text, states);
+}
+
+void RenderStats::draw(sf::RenderTarget& target, const sf::Shape& shape, const sf::RenderStates& states) {
+    // Fill is a fan around the centre; the outline a closed strip
+    int points = static_cast<int>(shape.getPointCount());
+    bool outlined = shape.getOutlineThickness() != 0.f;
+    int vertices = (points + 2) + (outlined ? (points + 1) * 2 : 0);
+    record(target, shape.getTexture(), states.shader, vertices, outlined ? 2 : 1);
+    target.draw(shape, states);
+}
+
+void RenderStats::draw(sf::RenderTarget& target, const sf::VertexArray& vertices, const sf::RenderStates& states) {
+    if (vertices.getVertexCount() == 0) return;
+    record(target, states.texture, states.shader, static_cast<int>(vertices.getVertexCount()), 1);
+    target.draw(vertices, states);
+}
+
+void RenderStats::draw(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states) {
+    record(target, states.texture, states.shader, 0, 1);
+    target.draw(drawable, states);
+}
+
+void RenderStats::draw(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t count, sf::PrimitiveType type,
+                       const sf::RenderStates& states) {
+    if (count == 0) return;
+    record(target, states.texture, states.shader, static_cast<int>(count), 1);
+    target.draw(vertices, count, type, states);
+}
+
+void RenderStats::draw(sf::RenderTarget& target, const sf::VertexBuffer& buffer, std::size_t first, std::size_t count,
+                       const sf::RenderStates& states) {
+    if (count == 0) return;
+    record(target, states.texture, states.shader, static_cast<int>(count), 1);
+    target.draw(buffer, first, count, states);
+}
+
+void RenderStats::beginFrame() {
+    for (int i = 0; i < kCount; ++i) {
+        lastFrame[i] = frame[i];
+        window[i] += frame[i];
+        frame[i] = Counters();
+    }
+    ++windowFrames;
+    // display() and the next frame's clear rebind everything
+    lastTarget = nullptr;
+}
+
+RenderStats::Counters RenderStats::getLastFrameTotal() {
+    Counters total;
+    for (int i = 0; i < kCount; ++i) total += lastFrame[i];
+    return total;
+}
+
+RenderStats::Counters RenderStats::getWindowTotal() {
+    Counters total;
+    for (int i = 0; i < kCount; ++i) total += window[i];
+    return total;
+}
+
+void RenderStats::resetWindow() {
+    for (int i = 0; i < kCount; ++i) window[i] = Counters();
+    windowFrames = 0;
+}
+
+const char* RenderStats::getName(Subsystem s) {
+    switch (s) {
+        case Subsystem::MAP: return "map";
+        case Subsystem::DECALS: return "decals";
+        case Subsystem::ZOMBIES: return "zombies";
+        case Subsystem::BULLETS: return "bullets";
+        case Subsystem::PARTICLES: return "particles";
+        case Subsystem::PLAYER: return "player";
+        case Subsystem::OVERLAY: return "overlay";
+        case Subsystem::LIGHTS: return "lights";
+        case Subsystem::POSTFX: return "postfx";
+        case Subsystem::HUD: return "hud";
+        case Subsystem::MENUS: return "menus";
+        default: return "other";
+    }
+}
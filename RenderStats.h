@@ -0,0 +1,76 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+// Per-frame render counters: draw calls, vertices, texture/shader/target switches, broken
+// down by subsystem. sf::RenderTarget::draw isn't virtual, so instrumented code draws through
+// RenderStats::draw(), which counts and forwards. Counts go to the subsystem named by the
+// innermost live RenderStats::Scope.
+class RenderStats {
+public:
+    enum class Subsystem {
+        MAP, DECALS, ZOMBIES, BULLETS, PARTICLES, PLAYER, OVERLAY, LIGHTS, POSTFX, HUD, MENUS, OTHER,
+        COUNT
+    };
+
+    struct Counters {
+        int drawCalls = 0;
+        int vertices = 0;
+        int textureSwitches = 0;
+        int shaderSwitches = 0;
+        int targetSwitches = 0;
+        Counters& operator+=(const Counters& o);
+    };
+
+    // Attribute draws in this C++ scope to a subsystem (restores the previous one on exit)
+    class Scope {
+    public:
+        explicit Scope(Subsystem s) : previous(current) { current = s; }
+        ~Scope() { current = previous; }
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    private:
+        Subsystem previous;
+    };
+
+    // Counted equivalents of sf::RenderTarget::draw. Sprites, text and shapes report their
+    // real vertex counts and textures; other drawables only count the call.
+    static void draw(sf::RenderTarget& target, const sf::Sprite& sprite, const sf::RenderStates& states = sf::RenderStates::Default);
+    static void draw(sf::RenderTarget& target, const sf::Text& text, const sf::RenderStates& states = sf::RenderStates::Default);
+    static void draw(sf::RenderTarget& target, const sf::Shape& shape, const sf::RenderStates& states = sf::RenderStates::Default);
+    static void draw(sf::RenderTarget& target, const sf::VertexArray& vertices, const sf::RenderStates& states = sf::RenderStates::Default);
+    static void draw(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states = sf::RenderStates::Default);
+    static void draw(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t count, sf::PrimitiveType type,
+                     const sf::RenderStates& states = sf::RenderStates::Default);
+    static void draw(sf::RenderTarget& target, const sf::VertexBuffer& buffer, std::size_t first, std::size_t count,
+                     const sf::RenderStates& states = sf::RenderStates::Default);
+
+    // Close the current frame (its counters become getLastFrame()) and start a new one
+    static void beginFrame();
+    static const Counters& getLastFrame(Subsystem s) { return lastFrame[static_cast<int>(s)]; }
+    static Counters getLastFrameTotal();
+    // Sums over completed frames since resetWindow(), for the periodic profiler line
+    static const Counters& getWindow(Subsystem s) { return window[static_cast<int>(s)]; }
+    static Counters getWindowTotal();
+    static int getWindowFrames() { return windowFrames; }
+    static void resetWindow();
+
+    static const char* getName(Subsystem s);
+    // Subsystem of the innermost live Scope (deferred draws capture it at submit time)
+    static Subsystem getCurrentSubsystem() { return current; }
+
+private:
+    static void record(const sf::RenderTarget& target, const sf::Texture* texture, const sf::Shader* shader, int vertices, int calls);
+
+    static const int kCount = static_cast<int>(Subsystem::COUNT);
+    static Subsystem current;
+    static Counters frame[kCount];
+    static Counters lastFrame[kCount];
+    static Counters window[kCount];
+    static int windowFrames;
+
+    // Last bound state, to detect switches
+    static const sf::RenderTarget* lastTarget;
+    static const sf::Texture* lastTexture;
+    static const sf::Shader* lastShader;
+};
@@ -0,0 +1,63 @@
+#include "SpriteBatch.h"
+#include "RenderStats.h"
+#include <cmath>
+
+SpriteBatch::Group& SpriteBatch::groupFor(const sf::Texture* texture, const sf::BlendMode& blend) {
+    for (size_t i = 0; i < activeGroups; ++i) {
+        if (groups[i].texture == texture && groups[i].blend == blend) return groups[i];
+    }
+    if (activeGroups == groups.size()) groups.emplace_back();
+    Group& g = groups[activeGroups++];
+    g.texture = texture;
+    g.blend = blend;
+    g.vertices.clear();
+    return g;
+}
+
+void SpriteBatch::draw(const sf::Sprite& sprite, const sf::BlendMode& blend) {
+    const sf::Texture* tex = sprite.getTexture();
+    if (!tex) return;
+    draw(*tex, sprite.getTextureRect(), sprite.getTransform(), sprite.getColor(), blend);
+}
+
+void SpriteBatch::draw(const sf::Texture& texture, const sf::IntRect& rect, const sf::Transform& transform,
+                       const sf::Color& color, const sf::BlendMode& blend) {
+    Group& g = groupFor(&texture, blend);
+
+    // Same local geometry sf::Sprite uses: positions from the rect size, texcoords from the rect
+    float w = static_cast<float>(std::abs(rect.width));
+    float h = static_cast<float>(std::abs(rect.height));
+    float left = static_cast<float>(rect.left);
+    float right = left + static_cast<float>(rect.width);
+    float top = static_cast<float>(rect.top);
+    float bottom = top + static_cast<float>(rect.height);
+
+    sf::Vertex v0(transform.transformPoint(0.f, 0.f), color, sf::Vector2f(left, top));
+    sf::Vertex v1(transform.transformPoint(w, 0.f), color, sf::Vector2f(right, top));
+    sf::Vertex v2(transform.transformPoint(w, h), color, sf::Vector2f(right, bottom));
+    sf::Vertex v3(transform.transformPoint(0.f, h), color, sf::Vector2f(left, bottom));
+
+    g.vertices.append(v0);
+    g.vertices.append(v1);
+    g.vertices.append(v2);
+    g.vertices.append(v0);
+    g.vertices.append(v2);
+    g.vertices.append(v3);
+}
+
+void SpriteBatch::flush(sf::RenderTarget& target, const sf::RenderStates& baseStates) {
+    lastDrawCalls = 0;
+    lastQuadCount = 0;
+    for (size_t i = 0; i < activeGroups; ++i) {
+        Group& g = groups[i];
+        if (g.vertices.getVertexCount() == 0) continue;
+        sf::RenderStates states = baseStates;
+        states.texture = g.texture;
+        states.blendMode = g.blend;
+        RenderStats::draw(target, g.vertices, states);
+        lastDrawCalls++;
+        lastQuadCount += static_cast<int>(g.vertices.getVertexCount() / 6);
+        g.vertices.clear();
+    }
+    activeGroups = 0;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+// Collects textured quads per (texture, blend mode) and draws each group with a single
+// draw call. Groups are drawn in the order they were first used during the frame, so
+// callers should submit back-to-front by layer (e.g. shadows before bodies).
+class SpriteBatch {
+public:
+    // Queue a sprite using its own texture, texture rect, transform and color
+    void draw(const sf::Sprite& sprite, const sf::BlendMode& blend = sf::BlendAlpha);
+    // Queue a sprite-like quad with an explicit transform and color (no sf::Sprite needed)
+    void draw(const sf::Texture& texture, const sf::IntRect& rect, const sf::Transform& transform,
+              const sf::Color& color, const sf::BlendMode& blend = sf::BlendAlpha);
+
+    // Draw everything queued this frame and reset for the next one (keeps allocations)
+    void flush(sf::RenderTarget& target, const sf::RenderStates& baseStates = sf::RenderStates::Default);
+
+    int getLastDrawCalls() const { return lastDrawCalls; }
+    int getLastQuadCount() const { return lastQuadCount; }
+
+private:
+    struct Group {
+        const sf::Texture* texture = nullptr;
+        sf::BlendMode blend;
+        sf::VertexArray vertices{ sf::Triangles };
+    };
+
+    Group& groupFor(const sf::Texture* texture, const sf::BlendMode& blend);
+
+    // groups[0, activeGroups) are in use this frame; the rest are kept for reuse
+    std::vector<Group> groups;
+    size_t activeGroups = 0;
+
+    int lastDrawCalls = 0;
+    int lastQuadCount = 0;
+};
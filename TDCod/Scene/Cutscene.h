@@ -5,6 +5,7 @@
 #include <SFML/Window.hpp>
 #include <SFML/System.hpp>
 #include <SFML/Audio.hpp>
+#include "../../FramePacer.h"
 #include <iostream>
 #include <string>
 #include <vector>
@@ -75,6 +76,8 @@ private:
     sf::Clock fadeClock;
     sf::Clock dialogueClock;
     sf::Clock autoAdvanceClock;
+    // Frame limiter; the title menu idles at a low rate until it needs to animate
+    FramePacer framePacer;
     bool fadeEndTimerStarted = false;
 
 
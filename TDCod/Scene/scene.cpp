@@ -1,4 +1,5 @@
 #include "Cutscene.h"
+#include "../../FontService.h"
 #include <iostream>
 #include <sstream>
 #include <algorithm>
@@ -16,49 +17,6 @@ static constexpr float BACK_PANEL_MARGIN = 12.f;
 
 namespace TDCod {
 
-static std::string wrapText(sf::Text& textObject, const std::string& string, float maxWidth, const sf::Font& font, unsigned int charSize) {
-    std::string wrappedString;
-    std::string currentLine;
-    std::string word;
-    sf::Text tempText;
-    tempText.setFont(font);
-    tempText.setCharacterSize(charSize);
-
-    for (char character : string) {
-        if (character == ' ' || character == '\n' || character == '\t') {
-            tempText.setString(currentLine + word);
-            if (tempText.getLocalBounds().width > maxWidth && !currentLine.empty()) {
-                wrappedString += currentLine + '\n';
-                currentLine = word;
-            } else {
-                currentLine += word;
-            }
-
-            if (character == '\n') {
-                wrappedString += currentLine + '\n';
-                currentLine.clear();
-            } else {
-                currentLine += " ";
-            }
-            word.clear();
-        } else {
-            word += character;
-        }
-    }
-
-    tempText.setString(currentLine + word);
-    if (tempText.getLocalBounds().width > maxWidth && !currentLine.empty()) {
-        wrappedString += currentLine + '\n' + word;
-    } else {
-        wrappedString += currentLine + word;
-    }
-
-    size_t first = wrappedString.find_first_not_of("\n \t");
-    if (std::string::npos == first) return "";
-    size_t last = wrappedString.find_last_not_of("\n \t");
-    return wrappedString.substr(first, (last - first + 1));
-}
-
 Cutscene::Cutscene()
     : currentLineIndex(0), textDisplayTimer(0.0f), textDisplayDelay(0.02f), cutsceneFinished(false),
       currentCharIndex(0), currentLineComplete(false), dialogueActive(false),
@@ -159,6 +117,16 @@ void Cutscene::init() {
     skipPromptText.setFillColor(sf::Color(200,200,200));
     skipPromptText.setString("Press Space to Skip/Continue");
 
+    // Rasterize glyphs for the fixed text sizes up front so menus and dialogue don't hitch on first show
+    FontService::prewarm(font, 96, true, 0.f, "Echo's of Valkyrie");
+    FontService::prewarm(font, 52);
+    FontService::prewarm(font, 36);
+    FontService::prewarm(font, static_cast<unsigned int>(28u * SETTINGS_UI_SCALE));
+    FontService::prewarm(font2, 24);
+    FontService::prewarm(font2, static_cast<unsigned int>(18u * SETTINGS_UI_SCALE));
+    FontService::prewarm(dialogueDisplayFont, 24);
+    FontService::prewarm(dialogueDisplayFont, 18);
+
     currentShipSpeed = normalShipSpeed;
 
     // load icon textures (placeholders) and create sprites
@@ -221,6 +189,7 @@ void Cutscene::run(sf::RenderWindow& window) {
     controlsButtonText.setCharacterSize(menuFontSize);
     settingsButtonText.setCharacterSize(menuFontSize);
     exitButtonText.setCharacterSize(menuFontSize);
+    FontService::prewarm(font, menuFontSize, false, 0.f, "PlayControlsSettingsExit");
 
     startButtonText.setString("Play");
     sf::FloatRect startButtonBounds = startButtonText.getLocalBounds();
@@ -294,8 +263,14 @@ void Cutscene::run(sf::RenderWindow& window) {
 
     window.setMouseCursorVisible(true);
 
+    framePacer.setTargetFps(60.f);
+    framePacer.setIdleFps(20.f);
+
     sf::Clock frameClock;
     while (window.isOpen() && !cutsceneFinished) {
+        // The title menu and its panels only change on input, except while a slider is dragged
+        framePacer.setIdle((isMenuState && draggingSlider < 0) || !window.hasFocus());
+        framePacer.wait();
         float deltaTime = frameClock.restart().asSeconds();
         textDisplayTimer += deltaTime;
         handleEvents(window);
@@ -1300,7 +1275,7 @@ void TDCod::Cutscene::render(sf::RenderWindow& window) {
             // Wrap text to fit inside the dialog box (use small padding)
             const float padding = 12.0f;
             float maxTextWidth = dialogueBox.getSize().x - padding * 2.0f;
-            std::string wrapped = wrapText(dialogueText, visible, maxTextWidth, dialogueDisplayFont, dialogueText.getCharacterSize());
+            const std::string& wrapped = FontService::wrap(dialogueDisplayFont, 24, visible, maxTextWidth);
             dialogueText.setFont(dialogueDisplayFont);
             dialogueText.setCharacterSize(24);
             dialogueText.setFillColor(sf::Color::White);
@@ -0,0 +1,110 @@
+#include "TextureAtlas.h"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+    // Copy src into dst at (x, y) and repeat its outer rows/columns into the padding,
+    // so smoothed sampling at region edges never picks up a neighbour's pixels.
+    void blitExtruded(sf::Image& dst, const sf::Image& src, unsigned int x, unsigned int y, unsigned int pad) {
+        sf::Vector2u ss = src.getSize();
+        sf::Vector2u ds = dst.getSize();
+        int w = static_cast<int>(ss.x), h = static_cast<int>(ss.y);
+        int p = static_cast<int>(pad);
+        for (int sy = -p; sy < h + p; ++sy) {
+            int dy = static_cast<int>(y) + sy;
+            if (dy < 0 || dy >= static_cast<int>(ds.y)) continue;
+            int cy = std::clamp(sy, 0, h - 1);
+            for (int sx = -p; sx < w + p; ++sx) {
+                int dx = static_cast<int>(x) + sx;
+                if (dx < 0 || dx >= static_cast<int>(ds.x)) continue;
+                int cx = std::clamp(sx, 0, w - 1);
+                dst.setPixel(static_cast<unsigned int>(dx), static_cast<unsigned int>(dy), src.getPixel(static_cast<unsigned int>(cx), static_cast<unsigned int>(cy)));
+            }
+        }
+    }
+}
+
+TextureAtlas::TextureAtlas(unsigned int pageSize, unsigned int padding)
+    : pageSize(pageSize), padding(padding) {}
+
+bool TextureAtlas::add(const std::string& key, const std::string& path) {
+    PendingImage img;
+    img.key = key;
+    if (!img.image.loadFromFile(path)) return false;
+    if (img.image.getSize().x == 0 || img.image.getSize().y == 0) return false;
+    pending.push_back(std::move(img));
+    return true;
+}
+
+void TextureAtlas::build(bool smooth) {
+    if (pending.empty()) return;
+
+    // Shelf packing: tallest first, fill rows left to right, start a new row (or page) when full
+    std::sort(pending.begin(), pending.end(), [](const PendingImage& a, const PendingImage& b) {
+        return a.image.getSize().y > b.image.getSize().y;
+    });
+
+    struct Placement { size_t image; unsigned int page, x, y; };
+    std::vector<Placement> placements;
+    std::vector<sf::Vector2u> pageSizes;
+    unsigned int cursorX = 0, cursorY = 0, shelfH = 0;
+    int openPage = -1;
+
+    for (size_t i = 0; i < pending.size(); ++i) {
+        sf::Vector2u s = pending[i].image.getSize();
+        unsigned int w = s.x + padding * 2;
+        unsigned int h = s.y + padding * 2;
+        if (w > pageSize || h > pageSize) {
+            // Oversized image: its own exactly-sized page
+            pageSizes.push_back(sf::Vector2u(w, h));
+            placements.push_back({ i, static_cast<unsigned int>(pageSizes.size() - 1), padding, padding });
+            continue;
+        }
+        if (openPage >= 0 && cursorX + w > pageSize) {
+            cursorX = 0;
+            cursorY += shelfH;
+            shelfH = 0;
+        }
+        if (openPage < 0 || cursorY + h > pageSize) {
+            pageSizes.push_back(sf::Vector2u(pageSize, pageSize));
+            openPage = static_cast<int>(pageSizes.size() - 1);
+            cursorX = cursorY = shelfH = 0;
+        }
+        placements.push_back({ i, static_cast<unsigned int>(openPage), cursorX + padding, cursorY + padding });
+        cursorX += w;
+        shelfH = std::max(shelfH, h);
+    }
+
+    // Trim the last shared page to the rows actually used
+    if (openPage >= 0) pageSizes[openPage].y = std::min(pageSize, cursorY + shelfH);
+
+    size_t firstPage = pages.size();
+    std::vector<sf::Image> images(pageSizes.size());
+    for (size_t p = 0; p < pageSizes.size(); ++p) images[p].create(pageSizes[p].x, pageSizes[p].y, sf::Color::Transparent);
+    for (const Placement& pl : placements) blitExtruded(images[pl.page], pending[pl.image].image, pl.x, pl.y, padding);
+
+    for (size_t p = 0; p < images.size(); ++p) {
+        std::unique_ptr<sf::Texture> tex(new sf::Texture());
+        if (!tex->loadFromImage(images[p])) {
+            std::cerr << "Warning: could not upload texture atlas page " << (firstPage + p) << std::endl;
+        }
+        tex->setSmooth(smooth);
+        pages.push_back(std::move(tex));
+    }
+    for (const Placement& pl : placements) {
+        const sf::Texture* tex = pages[firstPage + pl.page].get();
+        if (tex->getSize().x == 0) continue;
+        sf::Vector2u s = pending[pl.image].image.getSize();
+        TextureRegion r;
+        r.texture = tex;
+        r.rect = sf::IntRect(static_cast<int>(pl.x), static_cast<int>(pl.y), static_cast<int>(s.x), static_cast<int>(s.y));
+        regions[pending[pl.image].key] = r;
+    }
+    pending.clear();
+}
+
+TextureRegion TextureAtlas::get(const std::string& key) const {
+    auto it = regions.find(key);
+    if (it == regions.end()) return TextureRegion();
+    return it->second;
+}
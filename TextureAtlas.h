@@ -0,0 +1,53 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// A sub-rectangle of an atlas page. Sprites built from the same page share one GL texture,
+// so consecutive HUD draws don't rebind textures.
+struct TextureRegion {
+    const sf::Texture* texture = nullptr;
+    sf::IntRect rect;
+
+    bool valid() const { return texture != nullptr && rect.width > 0 && rect.height > 0; }
+    sf::Vector2u getSize() const { return sf::Vector2u(static_cast<unsigned int>(rect.width), static_cast<unsigned int>(rect.height)); }
+    // Point the sprite at this region (texture + texture rect)
+    void applyTo(sf::Sprite& sprite) const {
+        if (!valid()) return;
+        sprite.setTexture(*texture);
+        sprite.setTextureRect(rect);
+    }
+};
+
+// Packs small images into a few shared pages at load time.
+// Usage: add() every image, build() once, then look regions up by key.
+class TextureAtlas {
+public:
+    explicit TextureAtlas(unsigned int pageSize = 2048, unsigned int padding = 2);
+
+    // Queue an image for packing. Returns false (and queues nothing) if the file can't be loaded.
+    bool add(const std::string& key, const std::string& path);
+    // Pack every queued image into pages and upload them. Images larger than a page get a page of their own.
+    void build(bool smooth = true);
+
+    // Region for a key, or an invalid region when the key was never added / failed to load
+    TextureRegion get(const std::string& key) const;
+    bool has(const std::string& key) const { return regions.find(key) != regions.end(); }
+    size_t getPageCount() const { return pages.size(); }
+
+private:
+    struct PendingImage {
+        std::string key;
+        sf::Image image;
+    };
+
+    unsigned int pageSize;
+    unsigned int padding;
+    std::vector<PendingImage> pending;
+    // Pages are heap-allocated so region texture pointers survive later build() calls
+    std::vector<std::unique_ptr<sf::Texture>> pages;
+    std::unordered_map<std::string, TextureRegion> regions;
+};
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+// World rect covered by the target's current view, grown by `margin` on every side.
+// World renderers skip objects whose bounds fall completely outside it.
+inline sf::FloatRect viewCullRect(const sf::RenderTarget& target, float margin) {
+    const sf::View& v = target.getView();
+    sf::Vector2f half = v.getSize() * 0.5f;
+    return sf::FloatRect(v.getCenter().x - half.x - margin, v.getCenter().y - half.y - margin,
+                         v.getSize().x + margin * 2.0f, v.getSize().y + margin * 2.0f);
+}
+
+// Per-frame drawn/culled tallies reported by the profiler
+struct CullStats {
+    int drawn = 0;
+    int culled = 0;
+    void reset() { drawn = 0; culled = 0; }
+};
@@ -0,0 +1,51 @@
+#include "WorldOverlay.h"
+#include "RenderStats.h"
+
+void WorldOverlay::addRect(const sf::FloatRect& rect, const sf::Color& color) {
+    if (rect.width <= 0.f || rect.height <= 0.f) return;
+    sf::Vector2f tl(rect.left, rect.top);
+    sf::Vector2f tr(rect.left + rect.width, rect.top);
+    sf::Vector2f br(rect.left + rect.width, rect.top + rect.height);
+    sf::Vector2f bl(rect.left, rect.top + rect.height);
+    addTriangle(tl, tr, br, color, color, color);
+    addTriangle(tl, br, bl, color, color, color);
+}
+
+void WorldOverlay::addRectOutline(const sf::FloatRect& rect, float thickness, const sf::Color& color) {
+    if (thickness <= 0.f) return;
+    float l = rect.left - thickness;
+    float t = rect.top - thickness;
+    float w = rect.width + thickness * 2.f;
+    // top, bottom, then left/right between them so corners aren't blended twice
+    addRect(sf::FloatRect(l, t, w, thickness), color);
+    addRect(sf::FloatRect(l, rect.top + rect.height, w, thickness), color);
+    addRect(sf::FloatRect(l, rect.top, thickness, rect.height), color);
+    addRect(sf::FloatRect(rect.left + rect.width, rect.top, thickness, rect.height), color);
+}
+
+void WorldOverlay::addTriangle(const sf::Vector2f& a, const sf::Vector2f& b, const sf::Vector2f& c,
+                               const sf::Color& ca, const sf::Color& cb, const sf::Color& cc) {
+    triangles.append(sf::Vertex(a, ca));
+    triangles.append(sf::Vertex(b, cb));
+    triangles.append(sf::Vertex(c, cc));
+}
+
+void WorldOverlay::addLine(const sf::Vector2f& a, const sf::Vector2f& b, const sf::Color& ca, const sf::Color& cb) {
+    lines.append(sf::Vertex(a, ca));
+    lines.append(sf::Vertex(b, cb));
+}
+
+void WorldOverlay::flush(sf::RenderTarget& target) {
+    RenderStats::Scope statsScope(RenderStats::Subsystem::OVERLAY);
+    lastDrawCalls = 0;
+    if (triangles.getVertexCount() > 0) {
+        RenderStats::draw(target, triangles);
+        lastDrawCalls++;
+    }
+    if (lines.getVertexCount() > 0) {
+        RenderStats::draw(target, lines);
+        lastDrawCalls++;
+    }
+    triangles.clear();
+    lines.clear();
+}
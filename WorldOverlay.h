@@ -0,0 +1,26 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+// Untextured world-space overlay geometry (health bars, prompts, aim cone).
+// Everything added during a frame lives in two reusable vertex arrays, one for
+// filled triangles and one for lines, so the whole overlay costs at most two draws.
+class WorldOverlay {
+public:
+    void addRect(const sf::FloatRect& rect, const sf::Color& color);
+    // Outline drawn outside the rect, matching sf::Shape's positive outline thickness
+    void addRectOutline(const sf::FloatRect& rect, float thickness, const sf::Color& color);
+    void addTriangle(const sf::Vector2f& a, const sf::Vector2f& b, const sf::Vector2f& c,
+                     const sf::Color& ca, const sf::Color& cb, const sf::Color& cc);
+    void addLine(const sf::Vector2f& a, const sf::Vector2f& b, const sf::Color& ca, const sf::Color& cb);
+
+    // Draw and clear (allocations are kept for the next frame)
+    void flush(sf::RenderTarget& target);
+
+    int getLastDrawCalls() const { return lastDrawCalls; }
+
+private:
+    sf::VertexArray triangles{ sf::Triangles };
+    sf::VertexArray lines{ sf::Lines };
+    int lastDrawCalls = 0;
+};
@@ -13,7 +13,7 @@ ZombieWalker::ZombieWalker(float x, float y, float health, float attackDamage, f
 
     // If a spritesheet was provided (walkSheetTexture + walkRects), use that with Animator; otherwise fall back to per-frame textures
     if (hasWalkSheet && walkRects.size() > 0) {
-        sprite.setTexture(walkSheetTexture);
+        sprite.setTexture(*walkSheetTexture);
         // show the first frame immediately instead of the full sheet
         sprite.setTextureRect(walkRects[0]);
         // center origin based on first rect
@@ -29,7 +29,7 @@ ZombieWalker::ZombieWalker(float x, float y, float health, float attackDamage, f
     setState(ZombieState::WALK);
     // Ensure animator is configured and playing immediately (some edge cases need explicit start)
     if (hasWalkSheet && !walkRects.empty()) {
-        animator.setFrames(&walkSheetTexture, walkRects, walkFrameTime, true);
+        animator.setFrames(walkSheetTexture, walkRects, walkFrameTime, true);
         animator.play(true);
     } else if (!walkTextures.empty()) {
         animator.setFrames(&walkTextures, walkFrameTime, true);
@@ -39,11 +39,18 @@ ZombieWalker::ZombieWalker(float x, float y, float health, float attackDamage, f
 }
 
 void ZombieWalker::loadTextures() {
-    // load a single sheet instead of per-frame files
-    if (walkSheetTexture.loadFromFile("TDCod/Assets/ZombieWalker/zombie_move.png")) {
+    // load a single sheet instead of per-frame files. The sheets are loaded once and shared
+    // by every walker, so pooling more zombies doesn't re-read or re-upload them.
+    static sf::Texture sharedWalkSheet;
+    static const bool walkSheetLoaded = sharedWalkSheet.loadFromFile("TDCod/Assets/ZombieWalker/zombie_move.png");
+    static sf::Texture sharedAttackSheet;
+    static const bool attackSheetLoaded = sharedAttackSheet.loadFromFile("TDCod/Assets/ZombieWalker/zombie_attack.png");
+
+    if (walkSheetLoaded) {
+        walkSheetTexture = &sharedWalkSheet;
         hasWalkSheet = true;
         int frameW = 228; int frameH = 311; // set your frame size
-        sf::Vector2u ts = walkSheetTexture.getSize();
+        sf::Vector2u ts = walkSheetTexture->getSize();
         int cols = ts.x / frameW;
         int rows = ts.y / frameH;
         walkRects.clear();
@@ -52,10 +59,11 @@ void ZombieWalker::loadTextures() {
             walkRects.emplace_back(c*frameW, r*frameH, frameW, frameH);
     }
 
-    if (attackSheetTexture.loadFromFile("TDCod/Assets/ZombieWalker/zombie_attack.png")) {
+    if (attackSheetLoaded) {
+        attackSheetTexture = &sharedAttackSheet;
         hasAttackSheet = true;
         int frameW = 318; int frameH = 294; // set your frame size
-        sf::Vector2u ts = attackSheetTexture.getSize();
+        sf::Vector2u ts = attackSheetTexture->getSize();
         int cols = ts.x / frameW;
         int rows = ts.y / frameH;
         attackRects.clear();